@@ -885,6 +885,8 @@ struct pcre {
 	struct m {};
 	struct mod {};
 	struct mod_opt {};
+	struct mode_i {};
+	struct mode_no_i {};
 	struct n {};
 	struct number2 {};
 	struct number {};
@@ -933,6 +935,9 @@ struct pcre {
 	struct make_capture: ctll::action {};
 	struct make_capture_with_name: ctll::action {};
 	struct make_lazy: ctll::action {};
+	struct make_mode_case_insensitive: ctll::action {};
+	struct make_mode_case_sensitive: ctll::action {};
+	struct make_mode_scope: ctll::action {};
 	struct make_optional: ctll::action {};
 	struct make_possessive: ctll::action {};
 	struct make_property: ctll::action {};
@@ -955,6 +960,8 @@ struct pcre {
 	struct push_character_tab: ctll::action {};
 	struct push_empty: ctll::action {};
 	struct push_hexdec: ctll::action {};
+	struct push_mode_case_insensitive: ctll::action {};
+	struct push_mode_case_sensitive: ctll::action {};
 	struct push_name: ctll::action {};
 	struct push_number: ctll::action {};
 	struct push_property_name: ctll::action {};
@@ -1085,9 +1092,11 @@ struct pcre {
 	static constexpr auto rule(content_in_capture, ctll::set<'*','+','?','\x7B','|','\x7D'>) -> ctll::reject;
 
 	static constexpr auto rule(d, ctll::term<'<'>) -> ctll::push<ctll::anything, block_name, ctll::term<'>'>, content_in_capture, make_capture_with_name, ctll::term<'\x29'>>;
-	static constexpr auto rule(d, ctll::term<':'>) -> ctll::push<reset_capture, ctll::anything, content_in_capture, ctll::term<'\x29'>>;
+	static constexpr auto rule(d, ctll::term<':'>) -> ctll::push<reset_capture, ctll::anything, content_in_capture, make_mode_scope, ctll::term<'\x29'>>;
 	static constexpr auto rule(d, ctll::term<'!'>) -> ctll::push<reset_capture, ctll::anything, start_lookahead_negative, content_in_capture, look_finish, ctll::term<'\x29'>>;
 	static constexpr auto rule(d, ctll::term<'='>) -> ctll::push<reset_capture, ctll::anything, start_lookahead_positive, content_in_capture, look_finish, ctll::term<'\x29'>>;
+	static constexpr auto rule(d, ctll::term<'i'>) -> ctll::push<reset_capture, ctll::anything, mode_i>;
+	static constexpr auto rule(d, ctll::term<'-'>) -> ctll::push<reset_capture, ctll::anything, ctll::term<'i'>, mode_no_i>;
 
 	static constexpr auto rule(e, ctll::term<'d'>) -> ctll::push<ctll::anything, class_digit>;
 	static constexpr auto rule(e, ctll::term<'D'>) -> ctll::push<ctll::anything, class_nondigit>;
@@ -1183,6 +1192,12 @@ struct pcre {
 	static constexpr auto rule(mod_opt, ctll::term<'?'>) -> ctll::push<ctll::anything, make_lazy>;
 	static constexpr auto rule(mod_opt, ctll::set<'*','+','\x7B','\x7D'>) -> ctll::reject;
 
+	static constexpr auto rule(mode_i, ctll::term<'\x29'>) -> ctll::push<push_mode_case_insensitive, ctll::anything>;
+	static constexpr auto rule(mode_i, ctll::term<':'>) -> ctll::push<ctll::anything, content_in_capture, make_mode_case_insensitive, ctll::term<'\x29'>>;
+
+	static constexpr auto rule(mode_no_i, ctll::term<'\x29'>) -> ctll::push<push_mode_case_sensitive, ctll::anything>;
+	static constexpr auto rule(mode_no_i, ctll::term<':'>) -> ctll::push<ctll::anything, content_in_capture, make_mode_case_sensitive, ctll::term<'\x29'>>;
+
 	static constexpr auto rule(n, ctll::set<'0','1','2','3','4','5','6','7','8','9'>) -> ctll::push<ctll::anything, create_number, number2, repeat_ab, ctll::term<'\x7D'>, mod>;
 	static constexpr auto rule(n, ctll::term<'\x7D'>) -> ctll::push<repeat_at_least, ctll::anything, mod>;
 
@@ -1276,6 +1291,7 @@ struct accept { };
 struct reject { };
 struct start_mark { };
 struct end_mark { };
+struct non_empty_end_mark { }; // end_mark failing where the match started
 struct end_cycle_mark { };
 struct end_lookahead_mark { };
 template <size_t Id> struct numeric_mark { };
@@ -1315,6 +1331,17 @@ template <typename... Content> struct lookahead_negative { };
 struct assert_begin { };
 struct assert_end { };
 
+// `^` and `$` in multiline mode (they also match after / before '\n', see with_modes)
+struct assert_line_begin { };
+struct assert_line_end { };
+
+// inline modifiers `(?i)`, `(?-i)` and groups `(?i:...)`, `(?-i:...)` (they are removed after parsing, see with_modes)
+struct case_insensitive_mode { };
+struct case_sensitive_mode { };
+template <bool CaseInsensitive, typename... Content> struct mode_group { };
+// non-capturing group with a switch inside, the switch ends with the group
+template <typename... Content> struct mode_scope { };
+
 }
 
 #endif
@@ -1333,6 +1360,21 @@ struct assert_end { };
 #define CTRE_FLATTEN __attribute__((flatten))
 #endif
 
+// runtime-only fast paths (memchr, SIMD, ...) must stay out of constant evaluation
+#if defined(__cpp_lib_is_constant_evaluated)
+#define CTRE_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define CTRE_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define CTRE_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+
+#ifndef CTRE_IS_CONSTANT_EVALUATED
+#define CTRE_IS_CONSTANT_EVALUATED() true
+#endif
+
 #endif
 
 #include <cstdint>
@@ -1410,12 +1452,373 @@ using ascii_chars = char_range<'\x00','\x7F'>;
 #ifndef CTRE__ATOMS_UNICODE__HPP
 #define CTRE__ATOMS_UNICODE__HPP
 
-// master branch is not including unicode db (for now)
+// only the general category is included from the unicode db (for now)
 // #include "../unicode-db/unicode.hpp"
 #include <array>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
 
 namespace ctre {
 
+namespace uni {
+
+enum class category: uint8_t {
+	Lu, Ll, Lt, Lm, Lo, Mn, Mc, Me, Nd, Nl, No, Pc, Pd, Ps, Pe, Pi, Pf, Po, Sm, Sc, Sk, So, Zs, Zl, Zp, Cc, Cf, Cs, Co, Cn
+};
+
+// generated by unicode-db/gen_categories.py from the general categories of Unicode 14.0.0 (unicode-db/DerivedGeneralCategory.txt)
+// in three stages: (code point >> 10) -> middle block, ((code point >> 5) & 31) -> leaf block, (code point & 31) -> 'a' + category
+inline constexpr uint8_t category_stage1[1088] = {
+	0,1,2,3,4,5,6,7,8,9,10,11,12,13,13,13,13,13,13,14,13,13,13,13,13,13,13,13,13,13,13,13,
+	13,13,13,13,13,13,13,13,15,16,17,13,13,13,13,13,13,13,13,13,13,18,19,19,20,20,20,20,20,20,21,22,
+	23,24,25,26,27,28,29,30,31,32,33,34,13,35,33,33,33,36,33,33,33,33,33,33,33,33,37,38,13,13,13,13,
+	13,39,13,40,33,33,33,33,33,33,33,41,42,33,33,43,33,33,33,44,45,46,47,48,49,50,51,52,53,54,55,33,
+	13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+	13,13,13,13,13,13,13,13,13,56,13,13,13,57,58,13,13,13,13,59,13,13,13,13,13,13,60,33,33,33,61,33,
+	13,13,13,13,62,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	63,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+	20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,64,
+	20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+	20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,64,
+};
+
+inline constexpr uint16_t category_stage2[2080] = {
+	0,1,2,3,0,4,5,6,7,8,9,10,11,12,13,14,7,15,16,17,18,19,20,21,22,22,22,23,24,25,26,27,
+	28,29,17,7,30,7,31,7,7,32,33,17,34,35,36,37,38,39,40,41,39,39,42,43,44,45,46,39,39,47,48,49,
+	50,51,52,53,54,39,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,
+	81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,100,104,105,106,107,108,109,110,100,
+	39,111,112,113,114,28,115,116,39,39,39,39,39,39,39,39,39,39,117,39,118,119,120,39,121,39,122,123,124,28,28,125,
+	126,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,127,128,39,39,129,130,131,132,133,39,134,135,136,
+	137,39,138,139,140,141,39,142,143,144,145,146,39,147,148,149,150,39,151,152,153,154,155,100,156,157,158,159,160,161,39,162,
+	39,163,164,165,166,167,168,169,17,170,171,172,173,171,22,22,7,7,7,7,174,7,7,7,175,176,177,178,179,180,181,182,
+	183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,199,199,199,199,199,199,199,200,201,149,202,203,204,205,206,
+	149,207,208,209,210,149,149,211,149,149,149,149,149,212,213,214,149,149,149,215,149,149,149,149,149,149,149,216,217,149,218,219,
+	149,149,149,149,149,149,149,149,199,199,199,199,220,199,221,222,199,199,199,199,199,199,199,199,149,223,224,225,226,149,149,149,
+	28,29,17,227,7,7,7,228,17,229,39,230,231,232,232,22,233,234,235,100,236,149,149,237,149,149,149,149,149,149,238,239,
+	240,241,97,39,242,126,39,243,244,245,39,39,246,39,149,247,248,249,250,149,249,251,149,149,149,149,149,149,149,149,149,149,
+	39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+	39,39,39,39,39,39,39,39,39,39,39,39,39,39,149,149,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+	252,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+	39,39,39,39,253,149,254,165,39,39,39,39,39,39,39,39,255,256,7,257,258,39,39,259,260,261,7,262,263,264,265,266,
+	267,268,39,269,270,271,272,273,48,274,275,276,57,277,278,279,39,280,281,282,39,283,284,285,286,287,288,289,17,17,39,290,
+	39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,291,292,293,
+	294,294,294,294,294,294,294,294,294,294,294,294,294,294,294,294,294,294,294,294,294,294,294,294,294,294,294,294,294,294,294,294,
+	295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
+	295,295,295,295,295,295,295,295,39,39,39,39,39,39,39,39,39,39,39,296,39,39,297,100,298,299,300,39,39,301,302,39,
+	39,39,39,39,39,39,39,39,39,303,304,39,305,39,306,307,308,309,310,311,39,39,39,312,313,2,314,315,316,143,317,318,
+	319,320,321,100,39,39,39,322,323,324,194,325,326,327,328,329,100,100,100,100,276,39,330,331,39,332,333,334,335,39,336,100,
+	28,337,338,39,339,340,341,342,39,343,39,344,345,346,100,100,39,39,39,39,39,39,39,39,39,231,142,347,348,349,100,100,
+	350,351,352,353,143,354,100,355,356,357,100,100,39,358,359,209,360,361,362,363,364,100,365,366,39,367,368,369,370,371,100,100,
+	39,39,372,100,28,373,17,374,39,375,100,100,100,100,100,100,100,100,100,376,39,377,100,100,364,378,379,380,381,380,382,231,
+	383,384,385,386,160,387,388,389,390,391,392,393,160,394,395,396,397,398,100,100,399,400,401,402,403,404,405,406,100,100,100,100,
+	39,407,408,409,39,410,411,100,100,100,100,100,39,412,413,100,39,414,415,416,39,417,418,100,122,419,420,100,100,100,100,100,
+	39,421,100,100,100,28,17,422,423,424,425,100,100,426,427,428,429,430,431,39,432,433,39,139,100,100,100,100,100,100,100,100,
+	434,435,436,437,438,439,100,100,440,441,442,443,444,418,100,100,100,100,100,100,100,100,100,445,100,100,100,100,100,446,447,448,
+	39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,297,100,100,100,
+	194,194,194,449,39,39,39,39,39,39,450,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,
+	100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,
+	100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,380,39,39,451,
+	39,452,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,
+	39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,420,100,100,100,100,100,100,100,100,100,100,100,100,100,
+	39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,139,143,453,39,143,454,455,39,456,457,458,459,100,100,100,
+	100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,28,17,460,100,100,100,39,39,461,462,463,100,100,464,
+	39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,465,
+	39,39,39,39,39,39,142,100,372,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,
+	100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,466,
+	39,39,39,39,39,39,39,39,39,467,468,469,39,39,39,39,39,39,39,39,39,39,39,293,100,100,100,100,100,100,100,100,
+	39,39,39,470,471,472,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,
+	100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,22,473,474,149,149,149,475,100,
+	149,149,149,149,149,149,149,238,149,476,149,477,478,479,149,208,149,149,480,100,100,100,100,481,149,149,482,483,100,100,100,100,
+	484,485,486,487,488,489,490,491,492,493,494,495,496,484,485,497,487,498,499,500,491,501,502,503,504,505,506,507,508,509,510,511,
+	149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,22,512,22,513,514,515,100,100,100,100,100,100,100,100,100,100,
+	100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,516,100,100,100,100,100,100,100,
+	517,518,100,100,100,100,100,100,39,519,520,100,100,100,100,100,100,100,100,100,380,521,39,522,100,100,100,100,100,100,100,100,
+	100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,523,
+	39,39,39,39,39,39,524,100,28,525,526,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,
+	100,100,100,527,209,528,100,100,529,530,100,100,100,100,100,100,531,532,533,534,535,536,100,537,100,100,100,100,100,100,100,100,
+	149,538,149,149,237,539,540,238,541,149,149,149,149,542,100,543,544,545,546,547,100,100,100,100,149,149,149,149,149,149,149,548,
+	149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,549,550,149,149,149,237,149,149,551,552,
+	538,149,553,149,554,555,100,100,149,149,149,149,149,149,149,149,149,149,237,556,557,558,559,560,149,149,149,149,561,149,208,562,
+	39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,100,39,39,39,39,39,39,39,39,
+	39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,139,39,39,39,39,39,39,
+	339,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+	39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,563,39,39,39,39,39,39,39,39,39,39,
+	39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,564,
+	39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,339,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,
+	39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,565,100,100,100,100,100,
+	566,567,567,567,100,100,100,100,22,22,22,22,22,22,22,568,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,
+	295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,569,
+};
+
+inline constexpr char category_stage3[18241] =
+	"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzwrrrtrrrnorsrmrriiiiiiiiiirrsssrraaaaaaaaaaaaaaaaaaaaaaaaaanroulubbbbbbbbbbbbbbbbbbbbbbbbbbnsosz"
+	"wrttttvruveps{vuvskkubrrukeqkkkraaaaaaaaaaaaaaaaaaaaaaasaaaaaaabbbbbbbbbbbbbbbbbbbbbbbbsbbbbbbbbabababababababababababababababab"
+	"ababababababababababababbababababababababbabababababababababababababababababababababababaabababbbaababaabaaabbaaaabaabaaabbbaaba"
+	"abababaababbabaabaaababaabbeabbbeeeeacbacbacbababababababababbabababababababababbacbabaaababababababababababababababbbbbbbaabaab"
+	"babaaaabababababbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbebbbbbbbbbbbbbbbbbbbbbbbbbbbdddddddddddddddd"
+	"dduuuudddddddddddduuuuuuuuuuuuuuddddduuuuuuududuuuuuuuuuuuuuuuuuffffffffffffffffffffffffffffffffffffffffffffffffababduab~~dbbbra"
+	"~~~~uuaraaa~a~aabaaaaaaaaaaaaaaaaa~aaaaaaaaabbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbabbaaabbbababababababababababababbbbbabsabaabbaaa"
+	"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaabbbbbbbbbbbbbbbbabvfffffhhabababababababababababaabababababababbabababababababab"
+	"abababababababab~aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa~~drrrrrrbbbbbbbbbrm~~vvt~fffffffffffffffffffffffffffffffffffffffffffffmf"
+	"rffrffrf~~~~~~~~eeeeeeeeeeeeeeeeeeeeeeeeeee~~~~eeeerr~~~~~~~~~~~{{{{{{sssrrtrrvvfffffffffffr{rrreeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+	"deeeeeeeeeefffffffffffffffffffffiiiiiiiiiirrrreefeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeerefffffff{vffffffddffvffffeeiiiiiiiiiieeevve"
+	"rrrrrrrrrrrrrr~{efeeeeeeeeeeeeeeeeeeeeeeeeeeeeeefffffffffffffffffffffffffff~~eeeeeeeeeeeeeeeeeeeeeeeeefffffffffffe~~~~~~~~~~~~~~"
+	"iiiiiiiiiieeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeefffffffffddvrrrd~~ftteeeeeeeeeeeeeeeeeeeeeeffffdfffffffffdfffdfffff~~rrrrrrrrrrrrrrr~"
+	"eeeeeeeeeeeeeeeeeeeeeeeeefff~~r~eeeeeeeeeee~~~~~eeeeeeeeeeeeeeeeeeeeeeeeueeeeee~{{~~~~~~ffffffffeeeeeeeeedffffffffffffffffffffff"
+	"ff{ffffffffffffffffffffffffffffffffgeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeefgfegggffffffffggggfggefffffffeeeeeeee"
+	"eeffrriiiiiiiiiirdeeeeeeeeeeeeeeefgg~eeeeeeee~~ee~~eeeeeeeeeeeeeeeeeeeeee~eeeeeee~e~~~eeee~~fegggffff~~gg~~ggfe~~~~~~~~g~~~~ee~e"
+	"eeff~~iiiiiiiiiieettkkkkkkvterf~~ffg~eeeeee~~~~ee~~eeeeeeeeeeeeeeeeeeeeee~eeeeeee~ee~ee~ee~~f~gggff~~~~ff~~fff~~~f~~~~~~~eeee~e~"
+	"~~~~~~iiiiiiiiiiffeeefr~~~~~~~~~~ffg~eeeeeeeee~eee~eeeeeeeeeeeeeeeeeeeeee~eeeeeee~ee~eeeee~~fegggfffff~ffg~ggf~~e~~~~~~~~~~~~~~~"
+	"eeff~~iiiiiiiiiirt~~~~~~~effffff~fgg~eeeeeeee~~ee~~eeeeeeeeeeeeeeeeeeeeee~eeeeeee~ee~eeeee~~fegfgffff~~gg~~ggf~~~~~~~ffg~~~~ee~e"
+	"eeff~~iiiiiiiiiivekkkkkk~~~~~~~~~~fe~eeeeee~~~eee~eeee~~~ee~e~ee~~~ee~~~eee~~~eeeeeeeeeeee~~~~ggfgg~~~ggg~gggf~~e~~~~~~g~~~~~~~~"
+	"~~~~~~iiiiiiiiiikkkvvvvvvtv~~~~~fgggfeeeeeeee~eee~eeeeeeeeeeeeeeeeeeeeeee~eeeeeeeeeeeeeeee~~fefffgggg~fff~ffff~~~~~~~ff~eee~~e~~"
+	"eeff~~iiiiiiiiii~~~~~~~rkkkkkkkvefggreeeeeeee~eee~eeeeeeeeeeeeeeeeeeeeeee~eeeeeeeeee~eeeee~~fegfggggg~fgg~ggff~~~~~~~gg~~~~~~ee~"
+	"eeff~~iiiiiiiiii~ee~~~~~~~~~~~~~ffggeeeeeeeee~eee~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeffegggffff~ggg~gggfev~~~~eeegkkkkkkke"
+	"eeff~~iiiiiiiiiikkkkkkkkkveeeeee~fgg~eeeeeeeeeeeeeeeeee~~~eeeeeeeeeeeeeeeeeeeeeeee~eeeeeeeee~e~~eeeeeee~~~f~~~~gggfff~f~gggggggg"
+	"~~~~~~iiiiiiiiii~~ggr~~~~~~~~~~~~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeefeefffffff~~~~teeeeeedffffffffriiiiiiiiiirr~~~~"
+	"~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ee~e~eeeee~eeeeeeeeeeeeeeeeeeeeeeee~e~eeeeeeeeeefeefffffffffe~~eeeee~d~ffffff~~iiiiiiiiii~~eeee"
+	"evvvrrrrrrrrrrrrrrrvrvvvffvvvvvviiiiiiiiiikkkkkkkkkkvfvfvfnonoggeeeeeeee~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee~~~~ffffffffffffffg"
+	"fffffrffeeeeefffffffffff~ffffffffffffffffffffffffffffffffffff~vvvvvvvvfvvvvvv~vvrrrrrvvvvrr~~~~~eeeeeeeeeeeggffffgffffffgffggffe"
+	"iiiiiiiiiirrrrrreeeeeeggffeeeefffegggeegggggggeeeffffeeeeeeeeeeeeefggffggggggfegiiiiiiiiiigggfvvaaaaaa~a~~~~~a~~bbbbbbbbbbbbbbbb"
+	"bbbbbbbbbbbbbbbbbbbbbbbbbbbrdbbbeeeeeeeee~eeee~~eeeeeee~e~eeee~~eeeeeeeee~eeee~~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee~eeee~~eeeeeee~"
+	"e~eeee~~eeeeeeeeeeeeeee~eeeeeeeeeeeeeeeeeeeeeeeee~eeee~~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee~~fffrrrrrrrrrkkkkkkkkkkkkkkkkkkkk~~~"
+	"eeeeeeeeeeeeeeeevvvvvvvvvv~~~~~~aaaaaaaaaaaaaaaaaaaaaa~~bbbbbb~~meeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeevreeeeeeeeeeeeeeeee"
+	"weeeeeeeeeeeeeeeeeeeeeeeeeeno~~~eeeeeeeeeeerrrjjjeeeeeeee~~~~~~~eeeeeeeeeeeeeeeeeefffg~~~~~~~~~eeeeeeeeeeeeeeeeeeeffgrr~~~~~~~~~"
+	"eeeeeeeeeeeeeeeeeeff~~~~~~~~~~~~eeeeeeeeeeeee~eee~ff~~~~~~~~~~~~eeeeeeeeeeeeeeeeeeeeffgfffffffggggggggfggfffffffffffrrrdrrrtef~~"
+	"iiiiiiiiii~~~~~~kkkkkkkkkk~~~~~~rrrrrrmrrrrfff{fiiiiiiiiii~~~~~~eeedeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee~~~~~~~"
+	"eeeeeffeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeefe~~~~~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee~~~~~~~~~~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeee~"
+	"fffggggffggg~~~~ggfggggggfff~~~~v~~~rriiiiiiiiiieeeeeeeeeeeeeeeeeeeeeeeeeeeeee~~eeeee~~~~~~~~~~~eeeeeeeeeeee~~~~eeeeeeeeeeeeeeee"
+	"eeeeeeeeee~~~~~~iiiiiiiiiik~~~vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvveeeeeeeeeeeeeeeeeeeeeeeffggf~~rreeeeeeeeeeeeeeeeeeeeegfgfffffff~"
+	"fgfggffffffffggggggffffffffff~~fiiiiiiiiii~~~~~~iiiiiiiiii~~~~~~rrrrrrrdrrrrrr~~ffffffffffffffhffffffffffffffff~~~~~~~~~~~~~~~~~"
+	"ffffgeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeefgfffffgfgggggfggeeeeeeee~~~iiiiiiiiiirrrrrrrvvvvvvvvvvfffffffffvvvvvvvvvrr~"
+	"ffgeeeeeeeeeeeeeeeeeeeeeeeeeeeeeegffffggffgfffeeiiiiiiiiiieeeeeeeeeeeefgffgggfgfffgg~~~~~~~~rrrreeeeggggggggffffffffggff~~~rrrrr"
+	"iiiiiiiiii~~~eeeiiiiiiiiiieeeeeeeeeeeeeeeeeeeeeeeeeeeeeeddddddrrbbbbbbbbb~~~~~~~aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa~~aaa"
+	"rrrrrrrr~~~~~~~~fffrfffffffffffffgfffffffeeeefeeeeeefeegffe~~~~~bbbbbbbbbbbbdddddddddddddddddddddddddddddddddddddddddddddddddddd"
+	"dddddddddddbbbbbbbbbbbbbdbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbdddddabababababababababababbbbbbbbbabbbbbbbbbaaaaaaaabbbbbb~~aaaaaa~~"
+	"bbbbbbbbaaaaaaaabbbbbbbbaaaaaaaabbbbbb~~aaaaaa~~bbbbbbbb~a~a~a~abbbbbbbbaaaaaaaabbbbbbbbbbbbbb~~bbbbbbbbccccccccbbbbbbbbcccccccc"
+	"bbbbbbbbccccccccbbbbb~bbaaaacubuuubbb~bbaaaacuuubbbb~~bbaaaa~uuubbbbbbbbaaaaauuu~~bbb~bbaaaacuu~wwwwwwwwwww{{{{{mmmmmmrrpqnppqnp"
+	"rrrrrrrrxy{{{{{wrrrrrrrrrpqrrrrllrrrsnorrrrrrrrrrrsrlrrrrrrrrrrw{{{{{~{{{{{{{{{{kd~~kkkkkksssnodkkkkkkkkkksssno~ddddddddddddd~~~"
+	"ttttttttttttttttttttttttttttttttt~~~~~~~~~~~~~~~fffffffffffffhhhhfhhhffffffffffff~~~~~~~~~~~~~~~vvavvvvavvbaaabbaaabvavvsaaaaavv"
+	"vvvvavavavaaaavbaaaabeeeebvvbbaasssssabbbbvsvvbvkkkkkkkkkkkkkkkkjjjjjjjjjjjjjjjjjjjjjjjjjjjjjjjjjjjabjjjjkvv~~~~sssssvvvvvssvvvv"
+	"svvsvvsvvvvvvvsvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvssvvsvsvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvssssssssssssssssssssssssssssssssssssssssssss"
+	"vvvvvvvvnonovvvvvvvvvvvvvvvvvvvvssvvvvvvvnovvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvsvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvsssss"
+	"ssssssssssssssssssssvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvssssssvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv~~~~~~~~~~~~~~~~~~~~~~~~~"
+	"vvvvvvvvvvv~~~~~~~~~~~~~~~~~~~~~kkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkvvvvvvvvvvvvvvkkkkkkkkkkkkkkkkkkkkkk"
+	"vvvvvvvvvvvvvvvvvvvvvvvsvvvvvvvvvsvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvssssssssvvvvvvvvvvvvvvvsvvvvvvvvvvvvvvvv"
+	"vvvvvvvvnononononononokkkkkkkkkkkkkkkkkkkkkkkkkkkkkkvvvvvvvvvvvvsssssnosssssssssssssssssssssssssssssssnononononossssssssssssssss"
+	"sssnononononononononononosssssssssssssssssssssssssssssssnonossssssssssssssssssssssssssssssssnossvvvvvvvvvvvvvvvvssssssssssssssss"
+	"sssssvvssssssvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv~~vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv~vvvvvvvvvabaaabbabababaaaababbabbbbbbddaa"
+	"ababbvvvvvvababfffab~~~~~rrrrkrrbbbbbb~b~~~~~b~~eeeeeeeeeeeeeeeeeeeeeeee~~~~~~~dr~~~~~~~~~~~~~~feeeeeeeeeeeeeeeeeeeeeee~~~~~~~~~"
+	"eeeeeee~eeeeeee~eeeeeee~eeeeeee~rrpqpqrrrpqrpqrrrrrrrrrmrrmrpqrrpqnonononorrrrrdrrrrrrrrrrmmrrrrmrnrrrrrrrrrrrrrvvrrrnonononom~~"
+	"vvvvvvvvvvvvvvvvvvvvvvvvvv~vvvvvvvvvvvvvvvvvvvvvvvvv~~~~~~~~~~~~vvvvvvvvvvvvvvvvvvvvvv~~~~~~~~~~~~~~~~~~~~~~~~~~vvvvvvvvvvvv~~~~"
+	"wrrrvdejnononononovvnonononomnoovjjjjjjjjjffffggmdddddvvjjjdervveeeeeeeeeeeeeeeeeeeeeee~~ffuuddeeeeeeeeeeeeeeeeeeeeeeeeeeeerddde"
+	"~~~~~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee~eeeeeeeeeeeeeeeeeeeeeeeeeeeeee~vvkkkkvvvvvvvvvvvvvv~~~~~~~~~~~~eeeeeeeeeeeeeeee"
+	"vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv~kkkkkkkkkkvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvkkkkkkkkvkkkkkkkkkkkkkkkvvvvvvvvvvvvvvvvvkkkkkkkkkkkkkkk"
+	"eeeeeeeeeeeeeeeeeeeeedeeeeeeeeeeeeeeeeeeeeeee~~~vvvvvvvvvvvvvvvvvvvvvvv~~~~~~~~~eeeeeeeeeeeeeeeeeeeeeeeeeeeedrrreeeeeeeeeeeeeeee"
+	"iiiiiiiiiiee~~~~~~~~~~~~~~~~~~~~abababababababefhhhrffffffffffrdababababababababababababababddffeeeeeejjjjjjjjjjffrrrrrr~~~~~~~~"
+	"uuuuuuuuuuuuuuuuuuuuuuuddddddddduuabababababababbbabababababababababababababababdbbbbbbbbababaabababababduuababeababbbababababab"
+	"abababababaaaaabaaaaababababababababaaaabab~~~~~ab~b~babab~~~~~~~~~~~~~~~~~~~~~~~~dddabeddbeeeeeeefeeefeeeefeeeeeeeeeeeeeeeeeeee"
+	"eeeggffgvvvvf~~~kkkkkkvvtv~~~~~~eeeeeeeeeeeeeeeeeeeerrrr~~~~~~~~ggeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeegggggggggggg"
+	"ggggff~~~~~~~~rriiiiiiiiii~~~~~~ffffffffffffffffffeeeeeerrrereefeeeeeeffffffffrreeeeeeeeeeeeeeeeeeeeeeefffffffffffgg~~~~~~~~~~~r"
+	"eeeeeeeeeeeeeeeeeeeeeeeeeeeee~~~eeeeeeeeeeeeeeeeeeefggffffggffgggrrrrrrrrrrrrr~diiiiiiiiii~~~~rreeeeefdeeeeeeeeeiiiiiiiiiieeeee~"
+	"eeeeeeeeeffffffggffggff~~~~~~~~~eeefeeeeeeeefg~~iiiiiiiiii~~rrrreeeeeeeeeeeeeeeedeeeeeevvvegfgeeeeeeeeeeeeeeeeeefefffeeffeeeeeff"
+	"efe~~~~~~~~~~~~~~~~~~~~~~~~eedrreeeeeeeeeeegffggrreddgf~~~~~~~~~~eeeeee~~eeeeee~~eeeeee~~~~~~~~~eeeeeee~eeeeeee~bbbbbbbbbbbbbbbb"
+	"bbbbbbbbbbbbbbbbbbbbbbbbbbbuddddbbbbbbbbbduu~~~~bbbbbbbbbbbbbbbbeeeggfggfggrgf~~iiiiiiiiii~~~~~~eeee~~~~~~~~~~~~eeeeeeeeeeeeeeee"
+	"eeeeeee~~~~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee~~~~||||||||||||||||||||||||||||||||}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}"
+	"eeeeeeeeeeeeee~~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee~~~~~~bbbbbbb~~~~~~~~~~~~bbbbb~~~~~efeeeeeeeeeeseeeeeeeeeeeee~eeeee~e~"
+	"ee~ee~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeuuuuuuuuuuuuuuuuu~~~~~~~~~~~~~~~~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeon"
+	"vvvvvvvvvvvvvvvveeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee~~eeeeeeeeeeeeeeeeeeeeee~~~~~~~v~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~eeeeeeeeeeeetvvv"
+	"ffffffffffffffffrrrrrrrnor~~~~~~ffffffffffffffffrmmllnonononononononorrnorrrrlllrrr~rrrrmnononorrrsmsss~rtrr~~~~eeeee~eeeeeeeeee"
+	"eeeeeeeeeeeeeeeeeeeeeeeeeeeee~~{~rrrtrrrnorsrmrriiiiiiiiiirrsssrubbbbbbbbbbbbbbbbbbbbbbbbbbnsosnornorreeeeeeeeeedeeeeeeeeeeeeeee"
+	"eeeeeeeeeeeeeeeeeeeeeeeeeeeeeedd~~eeeeee~~eeeeee~~eeeeee~~eee~~~ttsuvtt~vssssvv~~~~~~~~~~{{{vv~~eeeeeeeeeeee~eeeeeeeeeeeeeeeeeee"
+	"eeeeeee~eeeeeeeeeeeeeeeeeee~ee~eeeeeeeeeeeeeee~~eeeeeeeeeeeeee~~eeeeeeeeeeeeeeeeeeeeeeeeeee~~~~~rrr~~~~kkkkkkkkkkkkkkkkkkkkkkkkk"
+	"kkkkkkkkkkkkkkkkkkkk~~~vvvvvvvvvjjjjjjjjjjjjjjjjjjjjjkkkkvvvvvvvvvvvvvvvvvkkvvv~vvvvvvvvvvvvv~~~v~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~"
+	"~~~~~~~~~~~~~~~~vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvf~~eeeeeeeeeeeeeeeee~~~~~~~~~~~~~~~fkkkkkkkkkkkkkkkkkkkkkkkkkkk~~~~"
+	"kkkk~~~~~~~~~eeeeeeeeeeeeeeeeeeeejeeeeeeeej~~~~~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeefffff~~~~~eeeeeeeeeeeeeeeeeeeeeeeeeeeeee~r"
+	"eeee~~~~eeeeeeeerjjjjj~~~~~~~~~~aaaaaaaabbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee~~"
+	"iiiiiiiiii~~~~~~aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa~~~~bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb~~~~eeeeeeee~~~~~~~~eeeeeeeeeeeeeeee"
+	"eeee~~~~~~~~~~~raaaaaaaaaaa~aaaaaaaaaaaaaaa~aaaaaaa~aa~bbbbbbbbbbb~bbbbbbbbbbbbbbb~bbbbbbb~bb~~~eeeeeeee~~~~~~~~~~~~~~~~~~~~~~~~"
+	"dddddd~dddddddddddddddddddddddddddddddddddddddddd~ddddddddd~~~~~eeeeee~~e~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee~ee~~~e~~e"
+	"eeeeeeeeeeeeeeeeeeeeee~rkkkkkkkkeeeeeeeeeeeeeeeeeeeeeeevvkkkkkkk~~~~~~~kkkkkkkkk~~~~~~~~~~~~~~~~eeeeeeeeeeeeeeeeeee~ee~~~~~kkkkk"
+	"eeeeeeeeeeeeeeeeeeeeeekkkkkk~~~reeeeeeeeeeeeeeeeeeeeeeeeee~~~~~reeeeeeeeeeeeeeeeeeeeeeee~~~~kkeekkkkkkkkkkkkkkkk~~kkkkkkkkkkkkkk"
+	"efff~ff~~~~~ffffeeee~eee~eeeeeeeeeeeeeeeeeeeeeeeeeeeee~~fff~~~~fkkkkkkkkk~~~~~~~rrrrrrrrr~~~~~~~eeeeeeeeeeeeeeeeeeeeeeeeeeeeekkr"
+	"eeeeeeeeeeeeeeeeeeeeeeeeeeeeekkkeeeeeeeeveeeeeeeeeeeeeeeeeeeeeeeeeeeeff~~~~kkkkkrrrrrrr~~~~~~~~~eeeeeeeeeeeeeeeeeeeeee~~~rrrrrrr"
+	"eeeeeeeeeeeeeeeeeeeeee~~kkkkkkkkeeeeeeeeeeeeeeeeeee~~~~~kkkkkkkkeeeeeeeeeeeeeeeeee~~~~~~~rrrr~~~~~~~~~~~~kkkkkkk~~~~~~~~~~~~~~~~"
+	"eeeeeeeee~~~~~~~~~~~~~~~~~~~~~~~aaaaaaaaaaaaaaaaaaa~~~~~~~~~~~~~bbbbbbbbbbbbbbbbbbb~~~~~~~kkkkkkeeeeffff~~~~~~~~iiiiiiiiii~~~~~~"
+	"kkkkkkkkkkkkkkkkkkkkkkkkkkkkkkk~eeeeeeeeee~ffm~~ee~~~~~~~~~~~~~~kkkkkkke~~~~~~~~eeeeeeeeeeeeeeeeeeeeeefffffffffffkkkkrrrrr~~~~~~"
+	"~~~~~~~~~~~~~~~~eeeeeeeeeeeeeeeeeeffffrrrr~~~~~~~~~~~~~~~~~~~~~~eeeeekkkkkkk~~~~~~~~~~~~~~~~~~~~gfgeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+	"eeeeeeeeeeeeeeeeeeeeeeeefffffffffffffffrrrrrrr~~~~kkkkkkkkkkkkkkkkkkkkiiiiiiiiiifeeffe~~~~~~~~~feeeeeeeeeeeeeeeegggffffggffrr{rr"
+	"rrf~~~~~~~~~~{~~eeeeeeeeeeeeeeeeeeeeeeeee~~~~~~~iiiiiiiiii~~~~~~fffeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeefffffgffffffff~iiiiiiiiii"
+	"rrrregge~~~~~~~~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeefrre~~~~~~~~~eeeeeeeeeeeeeeeeeeegggfffffffffggeeeerrrrffffrgfiiiiiiiiiiererrr"
+	"~kkkkkkkkkkkkkkkkkkkk~~~~~~~~~~~eeeeeeeeeeeeeeeeee~eeeeeeeeeeeeeeeeeeeeeeeeegggfffggfgffrrrrrrf~eeeeeee~e~eeee~eeeeeeeeeeeeeee~e"
+	"eeeeeeeeer~~~~~~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeefgggffffffff~~~~~iiiiiiiiii~~~~~~ffgg~eeeeeeee~~ee~~eeeeeeeeeeeee"
+	"eeeeeeeee~eeeeeee~ee~eeeee~ffeggfgggg~~gg~~ggg~~e~~~~~~g~~~~~eeeeegg~~fffffff~~~fffff~~~~~~~~~~~eeeeeeeeeeeeeeeeeeeeegggffffffff"
+	"ggfffgfeeeerrrrriiiiiiiiiirr~rfeee~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~eeeeeeeeeeeeeeeegggffffffgfggggffgffeere~~~~~~~~iiiiiiiiii~~~~~~"
+	"eeeeeeeeeeeeeeegggffff~~ggggffgffrrrrrrrrrrrrrrrrrrrrrrreeeeff~~eeeeeeeeeeeeeeeegggffffffffggfgffrrre~~~~~~~~~~~iiiiiiiiii~~~~~~"
+	"rrrrrrrrrrrrr~~~~~~~~~~~~~~~~~~~eeeeeeeeeeefgfggffffffgfer~~~~~~iiiiiiiiii~~~~~~~~~~~~~~~~~~~~~~ggffffgfffff~~~~iiiiiiiiiikkrrrv"
+	"eeeeeee~~~~~~~~~~~~~~~~~~~~~~~~~eeeeeeeeeeeegggfffffffffgffr~~~~iiiiiiiiiikkkkkkkkk~~~~~~~~~~~~eeeeeeee~~e~~eeeeeeee~ee~eeeeeeee"
+	"eeeeeeeeeeeeeeeegggggg~gg~~ffgfegegfrrr~~~~~~~~~iiiiiiiiii~~~~~~eeeeeeee~~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeegggffff~~ffgggg"
+	"fereg~~~~~~~~~~~~~~~~~~~~~~~~~~~effffffffffeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeffffffgeffffrrrrrrrrf~~~~~~~~effffffggfffeeee"
+	"eeeeeeeeeefffffffffffffgffrrrerrrrr~~~~~~~~~~~~~eeeeeeeeeeeeeeeeeeeeeeeee~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeegfffffff~ffffffgf"
+	"errrrr~~~~~~~~~~iiiiiiiiiikkkkkkkkkkkkkkkkkkk~~~rreeeeeeeeeeeeeeeeeeeeeeeeeeeeee~~ffffffffffffffffffffff~gfffffffgffgff~~~~~~~~~"
+	"eeeeeee~ee~eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeffffff~~~f~ff~fffffffef~~~~~~~~iiiiiiiiii~~~~~~eeeeee~ee~eeeeeeeeeeeeeeeeeeeeee"
+	"eeeeeeeeeeggggg~ff~ggfgfe~~~~~~~eeeeeeeeeeeeeeeeeeeffggrr~~~~~~~~~~~~~~~~~~~~~~~e~~~~~~~~~~~~~~~kkkkkkkkkkkkkkkkkkkkkvvvvvvvvttt"
+	"tvvvvvvvvvvvvvvvvv~~~~~~~~~~~~~rjjjjjjjjjjjjjjj~rrrrr~~~~~~~~~~~eeee~~~~~~~~~~~~~~~~~~~~~~~~~~~~eeeeeeeeeeeeeeeeerr~~~~~~~~~~~~~"
+	"eeeeeeeeeeeeeee~{{{{{{{{{~~~~~~~iiiiiiiiii~~~~rreeeeeeeeeeeeeeeeiiiiiiiiii~~~~~~eeeeeeeeeeeeeeeeeeeeeeeeeeeeee~~fffffr~~~~~~~~~~"
+	"eeeeeeeeeeeeeeeefffffffrrrrrvvvvddddrv~~~~~~~~~~iiiiiiiiii~kkkkkkk~eeeeeeeeeeeeeeeeeeeee~~~~~eeeeeeeeeeeeeeeeeee~~~~~~~~~~~~~~~~"
+	"kkkkkkkkkkkkkkkkkkkkkkkrrrr~~~~~eeeeeeeeeee~~~~feggggggggggggggggggggggggggggggggggggggggggggggggggggggg~~~~~~~ffffddddddddddddd"
+	"ddrdf~~~~~~~~~~~gg~~~~~~~~~~~~~~eeeeeeeeeeeeeeeeeeeeeeee~~~~~~~~~~~~~~~~~~~~~~~~dddd~ddddddd~dd~eee~~~~~~~~~~~~~~~~~~~~~~~~~~~~~"
+	"~~~~~~~~~~~~~~~~eee~~~~~~~~~~~~~~~~~eeee~~~~~~~~eeeeeeeeeeeeeeeeeeeeeeeeeee~~~~~eeeeeeeeeeeee~~~eeeeeeeee~~~~~~~eeeeeeeeee~~vffr"
+	"{{{{~~~~~~~~~~~~~~~~~~~~~~~~~~~~ffffffffffffff~~fffffffffffffffffffffff~~~~~~~~~vvvvvvvvvvvvvvvvvvvv~~~~~~~~~~~~~~~~~~~~~~~~~~~~"
+	"vvvvvvv~~vvvvvvvvvvvvvvvvvvvvvvvvvvvvggfffvvvgggggg{{{{{{{{ffffffffvvfffffffvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvffffvvvvvvvvvvvvvvvvvv"
+	"vvfffv~~~~~~~~~~~~~~~~~~~~~~~~~~kkkkkkkkkkkkkkkkkkkk~~~~~~~~~~~~vvvvvvvvvvvvvvvvvvvvvvv~~~~~~~~~kkkkkkkkkkkkkkkkkkkkkkkkk~~~~~~~"
+	"aaaaaaaaaaaaaaaaaaaaaaaaaabbbbbbbbbbbbbbbbbbbbbbbbbbaaaaaaaaaaaaaaaaaaaaaaaaaabbbbbbb~bbbbbbbbbbbbbbbbbbaaaaaaaaaaaaaaaaaaaaaaaa"
+	"aabbbbbbbbbbbbbbbbbbbbbbbbbba~aa~~a~~aa~~aaaa~aaaaaaaabbbb~b~bbbbbbb~bbbbbbbbbbbaaaaaaaaaaaaaaaaaaaaaaaaaabbbbbbbbbbbbbbbbbbbbbb"
+	"bbbbaa~aaaa~~aaaaaaaa~aaaaaaa~bbbbbbbbbbbbbbbbbbbbbbbbbbaa~aaaa~aaaaa~a~~~aaaaaaa~bbbbbbbbbbbbbbbbbbbbbbbbbbaaaaaaaaaaaaaaaaaaaa"
+	"aaaaaabbbbbbbbbbbbbbbbbbbbbbbbbbaaaaaaaaaaaaaabbbbbbbbbbbbbbbbbbaabbbbbbbbbbbbbbbbbbbbbbbbbbaaaaaaaaaaaaaaaaaaaaaaaaaabbbbbbbbbb"
+	"bbbbbbbbbbbbbbbbaaaaaaaaaaaaaaaabbbbbb~~aaaaaaaaaaaaaaaaaaaaaaaaasbbbbbbbbbbbbbbbbbbbbbbbbbsbbbbbbaaaaaaaaaaaaaaaaaaaaaaaaasbbbb"
+	"bbbbbbbbbbbbbbbbbbbbbsbbbbbbaaaaaaaaaaaaaaaaaaaaaaaaasbbbbbbbbbbbbbbbbbbbbbbbbbsbbbbbbaaaaaaaaaaaaaaaaaaaaaaaaasbbbbbbbbbbbbbbbb"
+	"bbbbbbbbbsbbbbbbaaaaaaaaaaaaaaaaaaaaaaaaasbbbbbbbbbbbbbbbbbbbbbbbbbsbbbbbbab~~iiiiiiiiiiiiiiiiiiiiiiiiiiiiiiiiiiiiiiiiiiiiiiiiii"
+	"fffffffffffffffffffffffvvvvffffffffffffffffffvvvvvvvvfvvvvvvvvvvvvvvfvvrrrrr~~~~~~~~~~~~~~~fffff~fffffffffffffff~~~~~~~~~~~~~~~~"
+	"bbbbbbbbbbebbbbbbbbbbbbbbbbbbbb~fffffff~fffffffffffffffff~~fffffff~ff~fffff~~~~~~~~~~~~~~~~~~~~~eeeeeeeeeeeee~~~fffffffddddddd~~"
+	"iiiiiiiiii~~~~ev~~~~~~~~~~~~~~~~eeeeeeeeeeeeeef~~~~~~~~~~~~~~~~~eeeeeeeeeeeeffffiiiiiiiiii~~~~~teeeeeee~eeee~ee~eeeeeeeeeeeeeee~"
+	"eeeee~~kkkkkkkkkfffffff~~~~~~~~~aabbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbfffffffd~~~~iiiiiiiiii~~~~rr~~~~~~~~~~~~~~~~~kkkkkkkkkkkkkkk"
+	"kkkkkkkkkkkkvkkktkkkk~~~~~~~~~~~~kkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkkvkkkkkkkkkkkkkkk~~eeee~eeeeeeeeeeeeeeeeeeeeeeeeeee"
+	"~ee~e~~e~eeeeeeeeee~eeee~e~e~~~~~~e~~~~e~e~e~eee~ee~e~~e~e~e~e~e~ee~e~~eeee~eeeeeee~eeee~eeee~e~eeeeeeeeee~eeeeeeeeeeeeeeeee~~~~"
+	"~eee~eeeee~eeeeeeeeeeeeeeeee~~~~~~~~~~~~~~~~~~~~ss~~~~~~~~~~~~~~vvvvvvvvvvvv~~~~vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv~~vvvvvvvvvvvvvvv"
+	"~vvvvvvvvvvvvvvv~vvvvvvvvvvvvvvvkkkkkkkkkkkkkvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv~~~~~~~~~~~~~~~~~~~~~~~~vvvvvvvvvvvvvvvvvvvvvvvvvv"
+	"vvv~~~~~~~~~~~~~vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv~~~~vvvvvvvvv~~~~~~~vv~~~~~~~~~~~~~~vvvvvv~~~~~~~~~~~~~~~~~~~~~~~~~~"
+	"vvvvvvvvvvvvvvvvvvvvvvvvvvvuuuuuvvvvvvvvvvvvvvvvvvvvvvvv~~~~~vvvvvvvvvvvvvvvv~~~vvvvvvvvvvvvv~~~vvvvvvvvvvvvvvvvvvvvvvvvv~~~~~~~"
+	"vvvvvvvvvvvv~~~~v~~~~~~~~~~~~~~~vvvvvvvv~~~~~~~~vvvvvvvvvv~~~~~~vvvvvvvv~~~~~~~~vvvvvvvvvvvvvvvvvvvvvvvvvvvvvv~~vv~~~~~~~~~~~~~~"
+	"vvvvvvvvvvvvvv~~vvvvv~~~vvvvv~~~vvvvvvv~~~~~~~~~vvvvvvvvvvvvvvvvvvvvvvvvvvvvv~~~vvvvvvvvvvv~~~~~vvvvvv~~~~~~~~~~vvvvvvvvvv~~~~~~"
+	"vvvvvvvv~~~~~~~~vvvvvvv~~~~~~~~~vvvvvvvvvvvvvvvvvvv~vvvvvvvvvvvv~~~~~~~~~~~~~~~~iiiiiiiiii~~~~~~ee~~~~~~~~~~~~~~eeeeeeeeeeeeeeee"
+	"e~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~eeeeeeeeeee~~~~~~~~~~~~~~~~~~~~~~{~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{"
+	"ffffffffffffffff~~~~~~~~~~~~~~~~}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}~~";
+
+constexpr category category_of(uint32_t cp) noexcept {
+	if (cp > 0x10FFFFu) {
+		return category::Cn;
+	}
+	const unsigned middle = category_stage1[cp >> 10];
+	const unsigned leaf = category_stage2[middle * 32u + ((cp >> 5) & 31u)];
+	return static_cast<category>(category_stage3[leaf * 32u + (cp & 31u)] - 'a');
+}
+
+constexpr uint32_t category_bit(category c) noexcept {
+	return uint32_t{1} << static_cast<unsigned>(c);
+}
+
+template <typename... Categories> constexpr uint32_t category_mask(Categories... cs) noexcept {
+	return (category_bit(cs) | ... | uint32_t{0});
+}
+
+// loose matching of names (UAX44-LM3): case, '_', '-' and spaces are ignored
+constexpr char loose_name_char(char c) noexcept {
+	return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+constexpr bool loose_name_ignored(char c) noexcept {
+	return c == '_' || c == '-' || c == ' ';
+}
+
+constexpr bool loose_name_equal(std::string_view lhs, std::string_view rhs) noexcept {
+	size_t i = 0;
+	size_t j = 0;
+	for (;;) {
+		while (i != lhs.size() && loose_name_ignored(lhs[i])) ++i;
+		while (j != rhs.size() && loose_name_ignored(rhs[j])) ++j;
+		if (i == lhs.size() || j == rhs.size()) {
+			return i == lhs.size() && j == rhs.size();
+		}
+		if (loose_name_char(lhs[i++]) != loose_name_char(rhs[j++])) {
+			return false;
+		}
+	}
+}
+
+struct category_name {
+	std::string_view short_name;
+	std::string_view long_name;
+	uint32_t mask;
+};
+
+inline constexpr category_name category_names[] = {
+	{"L", "Letter", category_mask(category::Lu, category::Ll, category::Lt, category::Lm, category::Lo)},
+	{"LC", "Cased_Letter", category_mask(category::Lu, category::Ll, category::Lt)},
+	{"Lu", "Uppercase_Letter", category_mask(category::Lu)},
+	{"Ll", "Lowercase_Letter", category_mask(category::Ll)},
+	{"Lt", "Titlecase_Letter", category_mask(category::Lt)},
+	{"Lm", "Modifier_Letter", category_mask(category::Lm)},
+	{"Lo", "Other_Letter", category_mask(category::Lo)},
+	{"M", "Mark", category_mask(category::Mn, category::Mc, category::Me)},
+	{"Mn", "Nonspacing_Mark", category_mask(category::Mn)},
+	{"Mc", "Spacing_Mark", category_mask(category::Mc)},
+	{"Me", "Enclosing_Mark", category_mask(category::Me)},
+	{"N", "Number", category_mask(category::Nd, category::Nl, category::No)},
+	{"Nd", "Decimal_Number", category_mask(category::Nd)},
+	{"Nl", "Letter_Number", category_mask(category::Nl)},
+	{"No", "Other_Number", category_mask(category::No)},
+	{"P", "Punctuation", category_mask(category::Pc, category::Pd, category::Ps, category::Pe, category::Pi, category::Pf, category::Po)},
+	{"Pc", "Connector_Punctuation", category_mask(category::Pc)},
+	{"Pd", "Dash_Punctuation", category_mask(category::Pd)},
+	{"Ps", "Open_Punctuation", category_mask(category::Ps)},
+	{"Pe", "Close_Punctuation", category_mask(category::Pe)},
+	{"Pi", "Initial_Punctuation", category_mask(category::Pi)},
+	{"Pf", "Final_Punctuation", category_mask(category::Pf)},
+	{"Po", "Other_Punctuation", category_mask(category::Po)},
+	{"S", "Symbol", category_mask(category::Sm, category::Sc, category::Sk, category::So)},
+	{"Sm", "Math_Symbol", category_mask(category::Sm)},
+	{"Sc", "Currency_Symbol", category_mask(category::Sc)},
+	{"Sk", "Modifier_Symbol", category_mask(category::Sk)},
+	{"So", "Other_Symbol", category_mask(category::So)},
+	{"Z", "Separator", category_mask(category::Zs, category::Zl, category::Zp)},
+	{"Zs", "Space_Separator", category_mask(category::Zs)},
+	{"Zl", "Line_Separator", category_mask(category::Zl)},
+	{"Zp", "Paragraph_Separator", category_mask(category::Zp)},
+	{"C", "Other", category_mask(category::Cc, category::Cf, category::Cs, category::Co, category::Cn)},
+	{"Cc", "Control", category_mask(category::Cc)},
+	{"Cf", "Format", category_mask(category::Cf)},
+	{"Cs", "Surrogate", category_mask(category::Cs)},
+	{"Co", "Private_Use", category_mask(category::Co)},
+	{"Cn", "Unassigned", category_mask(category::Cn)},
+};
+
+// mask of categories for a general category value, or 0 for an unknown name
+constexpr uint32_t category_mask_from_name(std::string_view name) noexcept {
+	for (const category_name & entry: category_names) {
+		if (loose_name_equal(name, entry.short_name) || loose_name_equal(name, entry.long_name)) {
+			return entry.mask;
+		}
+	}
+	return 0;
+}
+
+}
+
 // properties name & value
 
 template <auto... Str> struct property_name { };
@@ -1430,17 +1833,62 @@ template <size_t Sz> constexpr std::string_view get_string_view(const std::array
 template <auto Name> struct binary_property;
 template <auto Name, auto Value> struct property;
 
-// unicode TS#18 level 1.2 general_category
-//template <uni::__binary_prop Property> struct binary_property<Property> {
-//	template <typename CharT> inline static constexpr bool match_char(CharT) noexcept {
-//		return uni::__get_binary_prop<Property>(c);
-//	}
-//};
+// code units are taken as code points (bytes of `char` as latin-1)
+template <typename CharT> constexpr uint32_t code_point_of(CharT c) noexcept {
+	return static_cast<uint32_t>(static_cast<std::make_unsigned_t<CharT>>(c));
+}
+
+// unicode TS#18 level 1.2 general_category (Categories is a mask of uni::category)
+template <uint32_t Categories> struct category_property {
+	static constexpr uint64_t ascii_half(uint32_t offset) noexcept {
+		uint64_t out{0};
+		for (uint32_t cp = 0; cp != 64; ++cp) {
+			if ((Categories >> static_cast<unsigned>(uni::category_of(offset + cp))) & 1u) {
+				out |= uint64_t{1} << cp;
+			}
+		}
+		return out;
+	}
+	static constexpr uint64_t ascii[2] = {ascii_half(0), ascii_half(64)};
+
+	template <typename CharT> inline static constexpr bool match_char(CharT c) noexcept {
+		const uint32_t cp = code_point_of(c);
+		if (cp < 128) {
+			return (ascii[cp >> 6] >> (cp & 63u)) & 1u;
+		}
+		return (Categories >> static_cast<unsigned>(uni::category_of(cp))) & 1u;
+	}
+};
+
+// `\p{Any}`, `\p{ASCII}` and `\p{Assigned}` have no data of their own
+struct any_code_point_property {
+	template <typename CharT> inline static constexpr bool match_char(CharT c) noexcept {
+		return code_point_of(c) <= 0x10FFFFu;
+	}
+};
+
+template <auto... Name> struct binary_property_builder {
+	static constexpr std::array<char, sizeof...(Name)> name{static_cast<char>(Name)...};
+	
+	static constexpr auto get() {
+		if constexpr (uni::loose_name_equal(get_string_view(name), "Any")) {
+			return any_code_point_property();
+		} else if constexpr (uni::loose_name_equal(get_string_view(name), "ASCII")) {
+			return char_range<0, 127>();
+		} else if constexpr (uni::loose_name_equal(get_string_view(name), "Assigned")) {
+			return negate<category_property<uni::category_mask(uni::category::Cn)>>();
+		} else if constexpr (uni::category_mask_from_name(get_string_view(name)) != 0) {
+			return category_property<uni::category_mask_from_name(get_string_view(name))>();
+		} else {
+			return ctll::reject{};
+		}
+	}
+};
 
 // unicode TS#18 level 1.2.2
 
 enum class property_type {
-	script, script_extension, age, block, unknown
+	general_category, script, script_extension, age, block, unknown
 };
 
 // unicode TS#18 level 1.2.2
@@ -1474,7 +1922,10 @@ enum class property_type {
 
 // nonbinary properties
 
-constexpr property_type property_type_from_name(std::string_view) noexcept {
+constexpr property_type property_type_from_name(std::string_view str) noexcept {
+	if (uni::loose_name_equal(str, "gc") || uni::loose_name_equal(str, "General_Category")) {
+		return property_type::general_category;
+	}
 	return property_type::unknown;
 	//using namespace std::string_view_literals;
 	//if (uni::__pronamecomp(str, "script"sv) == 0 || uni::__pronamecomp(str, "sc"sv) == 0) {
@@ -1507,6 +1958,18 @@ template <auto... Name> struct property_builder {
 	}
 };
 
+template <> struct property_type_builder<property_type::general_category> {
+	template <auto... Value> static constexpr auto get() {
+		constexpr std::array<char, sizeof...(Value)> value{static_cast<char>(Value)...};
+		constexpr uint32_t mask = uni::category_mask_from_name(get_string_view(value));
+		if constexpr (mask == 0) {
+			return ctll::reject{};
+		} else {
+			return category_property<mask>();
+		}
+	}
+};
+
 // unicode TS#18 level 1.2.2 script support
 
 //template <> struct property_type_builder<property_type::script> {
@@ -1932,6 +2395,34 @@ template <auto V, typename... Subject, typename... Ts, typename Parameters> stat
 	return pcre_context{ctll::push_front(lazy_optional<Subject...>(), ctll::list<Ts...>()), subject.parameters};
 }
 
+// (?i) case insensitive for rest of the group
+template <typename Term, typename... Ts, typename Parameters> static constexpr auto apply(pcre::push_mode_case_insensitive, Term, pcre_context<ctll::list<Ts...>, Parameters> subject) {
+	return pcre_context{ctll::push_front(case_insensitive_mode(), subject.stack), subject.parameters};
+}
+
+// (?-i) case sensitive for rest of the group
+template <typename Term, typename... Ts, typename Parameters> static constexpr auto apply(pcre::push_mode_case_sensitive, Term, pcre_context<ctll::list<Ts...>, Parameters> subject) {
+	return pcre_context{ctll::push_front(case_sensitive_mode(), subject.stack), subject.parameters};
+}
+
+// (?i:...) and (?-i:...)
+template <auto V, typename A, typename... Ts, typename Parameters> static constexpr auto apply(pcre::make_mode_case_insensitive, ctll::term<V>, pcre_context<ctll::list<A, Ts...>, Parameters> subject) {
+	return pcre_context{ctll::push_front(mode_group<true, A>(), ctll::list<Ts...>()), subject.parameters};
+}
+
+template <auto V, typename A, typename... Ts, typename Parameters> static constexpr auto apply(pcre::make_mode_case_sensitive, ctll::term<V>, pcre_context<ctll::list<A, Ts...>, Parameters> subject) {
+	return pcre_context{ctll::push_front(mode_group<false, A>(), ctll::list<Ts...>()), subject.parameters};
+}
+
+// (?:...) keeps a switch inside to itself
+template <auto V, typename A, typename... Ts, typename Parameters> static constexpr auto apply(pcre::make_mode_scope, ctll::term<V>, pcre_context<ctll::list<A, Ts...>, Parameters> subject) {
+	if constexpr (has_mode_switch(A{})) {
+		return pcre_context{ctll::push_front(mode_scope<A>(), ctll::list<Ts...>()), subject.parameters};
+	} else {
+		return subject;
+	}
+}
+
 #endif
 
 #ifndef CTRE__ACTIONS__REPEAT__HPP
@@ -2135,52 +2626,46 @@ template <auto... Str, auto V, typename... Ts, typename Parameters> static const
 
 // make_property
 template <auto V, auto... Name, typename... Ts, typename Parameters> static constexpr auto apply(pcre::make_property, ctll::term<V>, [[maybe_unused]] pcre_context<ctll::list<property_name<Name...>, Ts...>, Parameters> subject) {
-	return ctll::reject{};
-	//constexpr std::array<char, sizeof...(Name)> name{static_cast<char>(Name)...};
-	//constexpr auto p = uni::__binary_prop_from_string(get_string_view(name));
-    //
-	//if constexpr (p == uni::__binary_prop::unknown) {
-	//	return ctll::reject{};
-	//} else {
-	//	return pcre_context{ctll::push_front(binary_property<p>(), ctll::list<Ts...>()), subject.parameters};
-	//}
+	constexpr auto prop = binary_property_builder<Name...>::get();
+	
+	if constexpr (std::is_same_v<decltype(prop), const ctll::reject>) {
+		return ctll::reject{};
+	} else {
+		return pcre_context{ctll::push_front(prop, ctll::list<Ts...>()), subject.parameters};
+	}
 }
 
 // make_property
 template <auto V, auto... Value, auto... Name, typename... Ts, typename Parameters> static constexpr auto apply(pcre::make_property, ctll::term<V>, [[maybe_unused]] pcre_context<ctll::list<property_value<Value...>, property_name<Name...>, Ts...>, Parameters> subject) {
-	return ctll::reject{};
-	//constexpr auto prop = property_builder<Name...>::template get<Value...>();
-	//
-	//if constexpr (std::is_same_v<decltype(prop), ctll::reject>) {
-	//	return ctll::reject{};
-	//} else {
-	//	return pcre_context{ctll::push_front(prop, ctll::list<Ts...>()), subject.parameters};
-	//}
+	constexpr auto prop = property_builder<Name...>::template get<Value...>();
+	
+	if constexpr (std::is_same_v<decltype(prop), const ctll::reject>) {
+		return ctll::reject{};
+	} else {
+		return pcre_context{ctll::push_front(prop, ctll::list<Ts...>()), subject.parameters};
+	}
 }
 
 // make_property_negative
 template <auto V, auto... Name, typename... Ts, typename Parameters> static constexpr auto apply(pcre::make_property_negative, ctll::term<V>, [[maybe_unused]] pcre_context<ctll::list<property_name<Name...>, Ts...>, Parameters> subject) {
-	return ctll::reject{};
-	//constexpr std::array<char, sizeof...(Name)> name{static_cast<char>(Name)...};
-	//constexpr auto p = uni::__binary_prop_from_string(get_string_view(name));
-    //
-	//if constexpr (p == uni::__binary_prop::unknown) {
-	//	return ctll::reject{};
-	//} else {
-	//	return pcre_context{ctll::push_front(negate<binary_property<p>>(), ctll::list<Ts...>()), subject.parameters};
-	//}
+	constexpr auto prop = binary_property_builder<Name...>::get();
+	
+	if constexpr (std::is_same_v<decltype(prop), const ctll::reject>) {
+		return ctll::reject{};
+	} else {
+		return pcre_context{ctll::push_front(negate<std::remove_cv_t<decltype(prop)>>(), ctll::list<Ts...>()), subject.parameters};
+	}
 }
 
 // make_property_negative
 template <auto V, auto... Value, auto... Name, typename... Ts, typename Parameters> static constexpr auto apply(pcre::make_property_negative, ctll::term<V>, [[maybe_unused]] pcre_context<ctll::list<property_value<Value...>, property_name<Name...>, Ts...>, Parameters> subject) {
-	return ctll::reject{};
-	//constexpr auto prop = property_builder<Name...>::template get<Value...>();
-	//
-	//if constexpr (std::is_same_v<decltype(prop), ctll::reject>) {
-	//	return ctll::reject{};
-	//} else {
-	//	return pcre_context{ctll::push_front(negate<decltype(prop)>(), ctll::list<Ts...>()), subject.parameters};
-	//}
+	constexpr auto prop = property_builder<Name...>::template get<Value...>();
+	
+	if constexpr (std::is_same_v<decltype(prop), const ctll::reject>) {
+		return ctll::reject{};
+	} else {
+		return pcre_context{ctll::push_front(negate<std::remove_cv_t<decltype(prop)>>(), ctll::list<Ts...>()), subject.parameters};
+	}
 }
 
 #endif
@@ -2191,139 +2676,518 @@ template <auto V, auto... Value, auto... Name, typename... Ts, typename Paramete
 
 #endif
 
-#ifndef CTRE__EVALUATION__HPP
-#define CTRE__EVALUATION__HPP
+#ifndef CTRE__MULTILINE__HPP
+#define CTRE__MULTILINE__HPP
 
-#ifndef CTRE__RETURN_TYPE__HPP
-#define CTRE__RETURN_TYPE__HPP
+namespace ctre {
 
-#include <type_traits>
-#include <tuple>
-#include <string_view>
-#include <string>
+// modifier making `^` and `$` match also at line boundaries: ctre::search<"^ERROR", ctre::multiline>
+struct multiline { };
 
-namespace ctre {
-	
-struct not_matched_tag_t { };
+template <typename... Modifiers> static inline constexpr bool is_multiline_v = (std::is_same_v<Modifiers, multiline> || ... || false);
 
-static constexpr inline auto not_matched = not_matched_tag_t{};
-	
-template <size_t Id, typename Name = void> struct captured_content {
-	template <typename Iterator> class storage {
-		Iterator _begin{};
-		Iterator _end{};
-		
-		bool _matched{false};
-	public:
-		using char_type = typename std::iterator_traits<Iterator>::value_type;
-		
-		using name = Name;
-	
-		constexpr CTRE_FORCE_INLINE storage() noexcept {}
-	
-		constexpr CTRE_FORCE_INLINE void matched() noexcept {
-			_matched = true;
-		}
-		constexpr CTRE_FORCE_INLINE void unmatch() noexcept {
-			_matched = false;
-		}
-		constexpr CTRE_FORCE_INLINE void set_start(Iterator pos) noexcept {
-			_begin = pos;
-		}
-		constexpr CTRE_FORCE_INLINE storage & set_end(Iterator pos) noexcept {
-			_end = pos;
-			return *this;
-		}
-		constexpr CTRE_FORCE_INLINE Iterator get_end() const noexcept {
-			return _end;
-		}
-		
-	
-		constexpr auto begin() const noexcept {
-			return _begin;
-		}
-		constexpr auto end() const noexcept {
-			return _end;
-		}
-	
-		constexpr CTRE_FORCE_INLINE operator bool() const noexcept {
-			return _matched;
-		}
+// anchors of the pattern replaced with line anchors at compile-time
+template <typename T> constexpr auto line_anchors(T) noexcept {
+	return T{};
+}
 
-		constexpr CTRE_FORCE_INLINE auto size() const noexcept {
-			return static_cast<size_t>(std::distance(_begin, _end));
-		}
+constexpr auto line_anchors(assert_begin) noexcept {
+	return assert_line_begin{};
+}
 
-		constexpr CTRE_FORCE_INLINE auto to_view() const noexcept {
-			return std::basic_string_view<char_type>(&*_begin, static_cast<size_t>(std::distance(_begin, _end)));
-		}
-		
-		constexpr CTRE_FORCE_INLINE auto to_string() const noexcept {
-			return std::basic_string<char_type>(begin(), end());
-		}
-		
-		constexpr CTRE_FORCE_INLINE auto view() const noexcept {
-			return std::basic_string_view<char_type>(&*_begin, static_cast<size_t>(std::distance(_begin, _end)));
-		}
-		
-		constexpr CTRE_FORCE_INLINE auto str() const noexcept {
-			return std::basic_string<char_type>(begin(), end());
-		}
-		
-		constexpr CTRE_FORCE_INLINE operator std::basic_string_view<char_type>() const noexcept {
-			return to_view();
-		}
-		
-		constexpr CTRE_FORCE_INLINE explicit operator std::basic_string<char_type>() const noexcept {
-			return to_string();
-		}
-		
-		constexpr CTRE_FORCE_INLINE static size_t get_id() noexcept {
-			return Id;
-		}
-	};
-};
+constexpr auto line_anchors(assert_end) noexcept {
+	return assert_line_end{};
+}
 
-struct capture_not_exists_tag { };
+// sequences, selects, loops, lookaheads...
+template <template <typename...> typename Node, typename... Content> constexpr auto line_anchors(Node<Content...>) noexcept {
+	return Node<decltype(line_anchors(Content{}))...>{};
+}
 
-static constexpr inline auto capture_not_exists = capture_not_exists_tag{};
+template <size_t A, size_t B, typename... Content> constexpr auto line_anchors(repeat<A, B, Content...>) noexcept {
+	return repeat<A, B, decltype(line_anchors(Content{}))...>{};
+}
 
-template <typename... Captures> struct captures;
+template <size_t A, size_t B, typename... Content> constexpr auto line_anchors(lazy_repeat<A, B, Content...>) noexcept {
+	return lazy_repeat<A, B, decltype(line_anchors(Content{}))...>{};
+}
+
+template <size_t A, size_t B, typename... Content> constexpr auto line_anchors(possessive_repeat<A, B, Content...>) noexcept {
+	return possessive_repeat<A, B, decltype(line_anchors(Content{}))...>{};
+}
+
+template <size_t Id, typename... Content> constexpr auto line_anchors(capture<Id, Content...>) noexcept {
+	return capture<Id, decltype(line_anchors(Content{}))...>{};
+}
+
+template <size_t Id, typename Name, typename... Content> constexpr auto line_anchors(capture_with_name<Id, Name, Content...>) noexcept {
+	return capture_with_name<Id, Name, decltype(line_anchors(Content{}))...>{};
+}
+
+template <typename Name> constexpr auto line_anchors(back_reference_with_name<Name>) noexcept {
+	return back_reference_with_name<Name>{};
+}
+
+// every match starts at the beginning of a line (so a search can try only those)
+template <typename T> constexpr bool line_anchored(T) noexcept {
+	return false;
+}
+
+constexpr bool line_anchored(assert_line_begin) noexcept {
+	return true;
+}
+
+template <typename Head, typename... Tail> constexpr bool line_anchored(sequence<Head, Tail...>) noexcept {
+	return line_anchored(Head{});
+}
+
+template <typename... Opts> constexpr bool line_anchored(select<Opts...>) noexcept {
+	return sizeof...(Opts) > 0 && (line_anchored(Opts{}) && ... && true);
+}
+
+template <size_t Id, typename Head, typename... Tail> constexpr bool line_anchored(capture<Id, Head, Tail...>) noexcept {
+	return line_anchored(Head{});
+}
+
+template <size_t Id, typename Name, typename Head, typename... Tail> constexpr bool line_anchored(capture_with_name<Id, Name, Head, Tail...>) noexcept {
+	return line_anchored(Head{});
+}
+
+}
 
-template <typename Head, typename... Tail> struct captures<Head, Tail...>: captures<Tail...> {
-	Head head{};
-	constexpr CTRE_FORCE_INLINE captures() noexcept { }
-	template <size_t id> CTRE_FORCE_INLINE static constexpr bool exists() noexcept {
-		if constexpr (id == Head::get_id()) {
-			return true;
-		} else {
-			return captures<Tail...>::template exists<id>();
-		}
-	}
-	template <typename Name> CTRE_FORCE_INLINE static constexpr bool exists() noexcept {
-		if constexpr (std::is_same_v<Name, typename Head::name>) {
-			return true;
-		} else {
-			return captures<Tail...>::template exists<Name>();
-		}
-	}
-#if (__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
-	template <ctll::fixed_string Name> CTRE_FORCE_INLINE static constexpr bool exists() noexcept {
-#else
-	template <const auto & Name> CTRE_FORCE_INLINE static constexpr bool exists() noexcept {
 #endif
-		if constexpr (std::is_same_v<typename Head::name, void>) {
-			return captures<Tail...>::template exists<Name>();
-		} else {
-			if constexpr (Head::name::name.is_same_as(Name)) {
-				return true;
-			} else {
-				return captures<Tail...>::template exists<Name>();
-			}
-		}
+
+#ifndef CTRE__CASE_INSENSITIVE__HPP
+#define CTRE__CASE_INSENSITIVE__HPP
+
+#include <cstdint>
+
+namespace ctre {
+
+// modifier for case insensitive matching of the whole pattern: ctre::match<"utc", ctre::case_insensitive>
+struct case_insensitive { };
+
+template <typename... Modifiers> static inline constexpr bool is_case_insensitive_v = (std::is_same_v<Modifiers, case_insensitive> || ... || false);
+
+// ASCII case folding of the pattern at compile-time (other characters and back references are compared exactly)
+template <auto V> constexpr bool is_ascii_letter() noexcept {
+	return (static_cast<int64_t>(V) >= 'a' && static_cast<int64_t>(V) <= 'z') || (static_cast<int64_t>(V) >= 'A' && static_cast<int64_t>(V) <= 'Z');
+}
+
+template <typename T> constexpr auto fold_case(T) noexcept {
+	return T{};
+}
+
+template <auto V> constexpr auto fold_case(character<V>) noexcept {
+	if constexpr (is_ascii_letter<V>()) {
+		return set<character<V>, character<static_cast<decltype(V)>(V ^ 0x20)>>{};
+	} else {
+		return character<V>{};
 	}
-	template <size_t id> CTRE_FORCE_INLINE constexpr auto & select() noexcept {
-		if constexpr (id == Head::get_id()) {
+}
+
+template <auto... Str> constexpr auto fold_case(string<Str...>) noexcept {
+	if constexpr ((is_ascii_letter<Str>() || ... || false)) {
+		return sequence<decltype(fold_case(character<Str>{}))...>{};
+	} else {
+		return string<Str...>{};
+	}
+}
+
+template <auto A, auto B> constexpr auto fold_case(char_range<A, B>) noexcept {
+	using char_type = decltype(A);
+	constexpr int64_t lower_first = (static_cast<int64_t>(A) > 'a') ? static_cast<int64_t>(A) : 'a';
+	constexpr int64_t lower_last = (static_cast<int64_t>(B) < 'z') ? static_cast<int64_t>(B) : 'z';
+	constexpr int64_t upper_first = (static_cast<int64_t>(A) > 'A') ? static_cast<int64_t>(A) : 'A';
+	constexpr int64_t upper_last = (static_cast<int64_t>(B) < 'Z') ? static_cast<int64_t>(B) : 'Z';
+	using lower_as_upper = char_range<static_cast<char_type>(lower_first - 0x20), static_cast<char_type>(lower_last - 0x20)>;
+	using upper_as_lower = char_range<static_cast<char_type>(upper_first + 0x20), static_cast<char_type>(upper_last + 0x20)>;
+	if constexpr (lower_first <= lower_last && upper_first <= upper_last) {
+		return set<char_range<A, B>, lower_as_upper, upper_as_lower>{};
+	} else if constexpr (lower_first <= lower_last) {
+		return set<char_range<A, B>, lower_as_upper>{};
+	} else if constexpr (upper_first <= upper_last) {
+		return set<char_range<A, B>, upper_as_lower>{};
+	} else {
+		return char_range<A, B>{};
+	}
+}
+
+template <auto... Cs> constexpr auto fold_case(enumeration<Cs...>) noexcept {
+	return set<decltype(fold_case(character<Cs>{}))...>{};
+}
+
+// sets, sequences, selects, loops, lookaheads...
+template <template <typename...> typename Node, typename... Content> constexpr auto fold_case(Node<Content...>) noexcept {
+	return Node<decltype(fold_case(Content{}))...>{};
+}
+
+template <size_t A, size_t B, typename... Content> constexpr auto fold_case(repeat<A, B, Content...>) noexcept {
+	return repeat<A, B, decltype(fold_case(Content{}))...>{};
+}
+
+template <size_t A, size_t B, typename... Content> constexpr auto fold_case(lazy_repeat<A, B, Content...>) noexcept {
+	return lazy_repeat<A, B, decltype(fold_case(Content{}))...>{};
+}
+
+template <size_t A, size_t B, typename... Content> constexpr auto fold_case(possessive_repeat<A, B, Content...>) noexcept {
+	return possessive_repeat<A, B, decltype(fold_case(Content{}))...>{};
+}
+
+template <size_t Id, typename... Content> constexpr auto fold_case(capture<Id, Content...>) noexcept {
+	return capture<Id, decltype(fold_case(Content{}))...>{};
+}
+
+template <size_t Id, typename Name, typename... Content> constexpr auto fold_case(capture_with_name<Id, Name, Content...>) noexcept {
+	return capture_with_name<Id, Name, decltype(fold_case(Content{}))...>{};
+}
+
+template <typename Name> constexpr auto fold_case(back_reference_with_name<Name>) noexcept {
+	return back_reference_with_name<Name>{};
+}
+
+// inline modifiers
+template <typename T> constexpr bool has_mode_switch(T) noexcept {
+	return false;
+}
+
+constexpr bool has_mode_switch(case_insensitive_mode) noexcept {
+	return true;
+}
+
+constexpr bool has_mode_switch(case_sensitive_mode) noexcept {
+	return true;
+}
+
+template <template <typename...> typename Node, typename... Content> constexpr bool has_mode_switch(Node<Content...>) noexcept {
+	return (has_mode_switch(Content{}) || ... || false);
+}
+
+template <size_t A, size_t B, typename... Content> constexpr bool has_mode_switch(repeat<A, B, Content...>) noexcept {
+	return (has_mode_switch(Content{}) || ... || false);
+}
+
+template <size_t A, size_t B, typename... Content> constexpr bool has_mode_switch(lazy_repeat<A, B, Content...>) noexcept {
+	return (has_mode_switch(Content{}) || ... || false);
+}
+
+template <size_t A, size_t B, typename... Content> constexpr bool has_mode_switch(possessive_repeat<A, B, Content...>) noexcept {
+	return (has_mode_switch(Content{}) || ... || false);
+}
+
+template <size_t Id, typename... Content> constexpr bool has_mode_switch(capture<Id, Content...>) noexcept {
+	return (has_mode_switch(Content{}) || ... || false);
+}
+
+template <size_t Id, typename Name, typename... Content> constexpr bool has_mode_switch(capture_with_name<Id, Name, Content...>) noexcept {
+	return (has_mode_switch(Content{}) || ... || false);
+}
+
+template <typename Name> constexpr bool has_mode_switch(back_reference_with_name<Name>) noexcept {
+	return false;
+}
+
+template <bool CaseInsensitive, typename... Content> constexpr bool has_mode_switch(mode_group<CaseInsensitive, Content...>) noexcept {
+	return true;
+}
+
+// pattern with applied modes and the mode after it (a switch holds until end of its group, also over next alternatives)
+template <typename Type, bool CaseInsensitive> struct mode_result {
+	using type = Type;
+	static constexpr bool case_insensitive = CaseInsensitive;
+};
+
+template <typename... Content> struct mode_content { };
+
+template <bool CaseInsensitive, typename T> constexpr auto apply_modes(T) noexcept;
+
+// switches are replaced with empty, an alternative can consist only of one
+template <bool CaseInsensitive, typename... Done> constexpr auto apply_modes_content(mode_content<Done...>, ctll::list<>) noexcept {
+	return mode_result<mode_content<Done...>, CaseInsensitive>{};
+}
+
+template <bool CaseInsensitive, typename... Done, typename Head, typename... Tail> constexpr auto apply_modes_content(mode_content<Done...>, ctll::list<Head, Tail...>) noexcept {
+	if constexpr (std::is_same_v<Head, case_insensitive_mode>) {
+		return apply_modes_content<true>(mode_content<Done..., empty>{}, ctll::list<Tail...>{});
+	} else if constexpr (std::is_same_v<Head, case_sensitive_mode>) {
+		return apply_modes_content<false>(mode_content<Done..., empty>{}, ctll::list<Tail...>{});
+	} else {
+		using head = decltype(apply_modes<CaseInsensitive>(Head{}));
+		return apply_modes_content<head::case_insensitive>(mode_content<Done..., typename head::type>{}, ctll::list<Tail...>{});
+	}
+}
+
+template <bool CaseInsensitive, typename... Content> constexpr auto apply_modes_group(ctll::list<Content...>) noexcept {
+	return decltype(apply_modes_content<CaseInsensitive>(mode_content<>{}, ctll::list<Content...>{})){};
+}
+
+template <bool CaseInsensitive, typename T> constexpr auto apply_modes_leaf(T) noexcept {
+	if constexpr (CaseInsensitive) {
+		return mode_result<decltype(fold_case(T{})), CaseInsensitive>{};
+	} else {
+		return mode_result<T, CaseInsensitive>{};
+	}
+}
+
+template <template <typename...> typename Node, typename... Content> constexpr auto rebuild_node(mode_content<Content...>) noexcept {
+	return Node<Content...>{};
+}
+
+template <bool CaseInsensitive, typename T> constexpr auto apply_modes(T) noexcept {
+	return apply_modes_leaf<CaseInsensitive>(T{});
+}
+
+// mode switch inside a sequence continues after it
+template <bool CaseInsensitive, typename... Content> constexpr auto apply_modes(sequence<Content...>) noexcept {
+	if constexpr (has_mode_switch(sequence<Content...>{})) {
+		using inner = decltype(apply_modes_group<CaseInsensitive>(ctll::list<Content...>{}));
+		return mode_result<decltype(rebuild_node<sequence>(typename inner::type{})), inner::case_insensitive>{};
+	} else {
+		return apply_modes_leaf<CaseInsensitive>(sequence<Content...>{});
+	}
+}
+
+template <bool CaseInsensitive, template <typename...> typename Node, typename... Content> constexpr auto apply_modes(Node<Content...>) noexcept {
+	if constexpr (has_mode_switch(Node<Content...>{})) {
+		using inner = decltype(apply_modes_group<CaseInsensitive>(ctll::list<Content...>{}));
+		return mode_result<decltype(rebuild_node<Node>(typename inner::type{})), CaseInsensitive>{};
+	} else {
+		return apply_modes_leaf<CaseInsensitive>(Node<Content...>{});
+	}
+}
+
+template <bool CaseInsensitive, size_t A, size_t B, typename... Content> constexpr auto apply_modes(repeat<A, B, Content...>) noexcept {
+	if constexpr (has_mode_switch(repeat<A, B, Content...>{})) {
+		using inner = decltype(apply_modes<CaseInsensitive>(sequence<Content...>{}));
+		return mode_result<repeat<A, B, typename inner::type>, CaseInsensitive>{};
+	} else {
+		return apply_modes_leaf<CaseInsensitive>(repeat<A, B, Content...>{});
+	}
+}
+
+template <bool CaseInsensitive, size_t A, size_t B, typename... Content> constexpr auto apply_modes(lazy_repeat<A, B, Content...>) noexcept {
+	if constexpr (has_mode_switch(lazy_repeat<A, B, Content...>{})) {
+		using inner = decltype(apply_modes<CaseInsensitive>(sequence<Content...>{}));
+		return mode_result<lazy_repeat<A, B, typename inner::type>, CaseInsensitive>{};
+	} else {
+		return apply_modes_leaf<CaseInsensitive>(lazy_repeat<A, B, Content...>{});
+	}
+}
+
+template <bool CaseInsensitive, size_t A, size_t B, typename... Content> constexpr auto apply_modes(possessive_repeat<A, B, Content...>) noexcept {
+	if constexpr (has_mode_switch(possessive_repeat<A, B, Content...>{})) {
+		using inner = decltype(apply_modes<CaseInsensitive>(sequence<Content...>{}));
+		return mode_result<possessive_repeat<A, B, typename inner::type>, CaseInsensitive>{};
+	} else {
+		return apply_modes_leaf<CaseInsensitive>(possessive_repeat<A, B, Content...>{});
+	}
+}
+
+template <bool CaseInsensitive, size_t Id, typename... Content> constexpr auto apply_modes(capture<Id, Content...>) noexcept {
+	if constexpr (has_mode_switch(capture<Id, Content...>{})) {
+		using inner = decltype(apply_modes<CaseInsensitive>(sequence<Content...>{}));
+		return mode_result<capture<Id, typename inner::type>, CaseInsensitive>{};
+	} else {
+		return apply_modes_leaf<CaseInsensitive>(capture<Id, Content...>{});
+	}
+}
+
+template <bool CaseInsensitive, size_t Id, typename Name, typename... Content> constexpr auto apply_modes(capture_with_name<Id, Name, Content...>) noexcept {
+	if constexpr (has_mode_switch(capture_with_name<Id, Name, Content...>{})) {
+		using inner = decltype(apply_modes<CaseInsensitive>(sequence<Content...>{}));
+		return mode_result<capture_with_name<Id, Name, typename inner::type>, CaseInsensitive>{};
+	} else {
+		return apply_modes_leaf<CaseInsensitive>(capture_with_name<Id, Name, Content...>{});
+	}
+}
+
+template <bool CaseInsensitive, typename Name> constexpr auto apply_modes(back_reference_with_name<Name>) noexcept {
+	return mode_result<back_reference_with_name<Name>, CaseInsensitive>{};
+}
+
+// group with its own mode, the outer mode continues after it
+template <bool CaseInsensitive, bool GroupCaseInsensitive, typename... Content> constexpr auto apply_modes(mode_group<GroupCaseInsensitive, Content...>) noexcept {
+	using inner = decltype(apply_modes<GroupCaseInsensitive>(sequence<Content...>{}));
+	return mode_result<typename inner::type, CaseInsensitive>{};
+}
+
+// non-capturing group, the mode before it continues after it
+template <bool CaseInsensitive, typename... Content> constexpr auto apply_modes(mode_scope<Content...>) noexcept {
+	using inner = decltype(apply_modes<CaseInsensitive>(sequence<Content...>{}));
+	return mode_result<typename inner::type, CaseInsensitive>{};
+}
+
+template <bool CaseInsensitive, typename Pattern> constexpr auto with_case_modes(Pattern) noexcept {
+	if constexpr (has_mode_switch(Pattern{})) {
+		return typename decltype(apply_modes<CaseInsensitive>(Pattern{}))::type{};
+	} else if constexpr (CaseInsensitive) {
+		return decltype(fold_case(Pattern{})){};
+	} else {
+		return Pattern{};
+	}
+}
+
+// pattern after parsing with all modes applied (and without mode switches)
+template <bool CaseInsensitive, bool Multiline = false, typename Pattern> constexpr auto with_modes(Pattern) noexcept {
+	if constexpr (Multiline) {
+		return decltype(line_anchors(with_case_modes<CaseInsensitive>(Pattern{}))){};
+	} else {
+		return decltype(with_case_modes<CaseInsensitive>(Pattern{})){};
+	}
+}
+
+}
+
+#endif
+
+#ifndef CTRE__EVALUATION__HPP
+#define CTRE__EVALUATION__HPP
+
+#ifndef CTRE__RETURN_TYPE__HPP
+#define CTRE__RETURN_TYPE__HPP
+
+#include <type_traits>
+#include <tuple>
+#include <string_view>
+#include <string>
+
+namespace ctre {
+	
+struct not_matched_tag_t { };
+
+// characters of the subject a capture points into (utf8_iterator yields code points of bytes)
+template <typename Iterator> struct subject_units {
+	using char_type = typename std::iterator_traits<Iterator>::value_type;
+	
+	static constexpr CTRE_FORCE_INLINE auto data(Iterator begin) noexcept {
+		return &*begin;
+	}
+	static constexpr CTRE_FORCE_INLINE size_t size(Iterator begin, Iterator end) noexcept {
+		return static_cast<size_t>(std::distance(begin, end));
+	}
+	static constexpr CTRE_FORCE_INLINE auto to_string(Iterator begin, Iterator end) noexcept {
+		return std::basic_string<char_type>(begin, end);
+	}
+};
+
+static constexpr inline auto not_matched = not_matched_tag_t{};
+	
+template <size_t Id, typename Name = void> struct captured_content {
+	template <typename Iterator> class storage {
+		Iterator _begin{};
+		Iterator _end{};
+		
+		bool _matched{false};
+	public:
+		using char_type = typename subject_units<Iterator>::char_type;
+		
+		using name = Name;
+	
+		constexpr CTRE_FORCE_INLINE storage() noexcept {}
+	
+		constexpr CTRE_FORCE_INLINE void matched() noexcept {
+			_matched = true;
+		}
+		constexpr CTRE_FORCE_INLINE void unmatch() noexcept {
+			_matched = false;
+		}
+		constexpr CTRE_FORCE_INLINE void set_start(Iterator pos) noexcept {
+			_begin = pos;
+		}
+		constexpr CTRE_FORCE_INLINE storage & set_end(Iterator pos) noexcept {
+			_end = pos;
+			return *this;
+		}
+		constexpr CTRE_FORCE_INLINE Iterator get_end() const noexcept {
+			return _end;
+		}
+		
+	
+		constexpr auto begin() const noexcept {
+			return _begin;
+		}
+		constexpr auto end() const noexcept {
+			return _end;
+		}
+	
+		constexpr CTRE_FORCE_INLINE operator bool() const noexcept {
+			return _matched;
+		}
+
+		constexpr CTRE_FORCE_INLINE auto size() const noexcept {
+			return subject_units<Iterator>::size(_begin, _end);
+		}
+
+		constexpr CTRE_FORCE_INLINE auto to_view() const noexcept {
+			return std::basic_string_view<char_type>(subject_units<Iterator>::data(_begin), subject_units<Iterator>::size(_begin, _end));
+		}
+		
+		constexpr CTRE_FORCE_INLINE auto to_string() const noexcept {
+			return subject_units<Iterator>::to_string(_begin, _end);
+		}
+		
+		constexpr CTRE_FORCE_INLINE auto view() const noexcept {
+			return to_view();
+		}
+		
+		constexpr CTRE_FORCE_INLINE auto str() const noexcept {
+			return to_string();
+		}
+		
+		constexpr CTRE_FORCE_INLINE operator std::basic_string_view<char_type>() const noexcept {
+			return to_view();
+		}
+		
+		constexpr CTRE_FORCE_INLINE explicit operator std::basic_string<char_type>() const noexcept {
+			return to_string();
+		}
+		
+		constexpr CTRE_FORCE_INLINE static size_t get_id() noexcept {
+			return Id;
+		}
+	};
+};
+
+struct capture_not_exists_tag { };
+
+static constexpr inline auto capture_not_exists = capture_not_exists_tag{};
+
+template <typename... Captures> struct captures;
+
+template <typename Head, typename... Tail> struct captures<Head, Tail...>: captures<Tail...> {
+	Head head{};
+	constexpr CTRE_FORCE_INLINE captures() noexcept { }
+	template <size_t id> CTRE_FORCE_INLINE static constexpr bool exists() noexcept {
+		if constexpr (id == Head::get_id()) {
+			return true;
+		} else {
+			return captures<Tail...>::template exists<id>();
+		}
+	}
+	template <typename Name> CTRE_FORCE_INLINE static constexpr bool exists() noexcept {
+		if constexpr (std::is_same_v<Name, typename Head::name>) {
+			return true;
+		} else {
+			return captures<Tail...>::template exists<Name>();
+		}
+	}
+#if (__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
+	template <ctll::fixed_string Name> CTRE_FORCE_INLINE static constexpr bool exists() noexcept {
+#else
+	template <const auto & Name> CTRE_FORCE_INLINE static constexpr bool exists() noexcept {
+#endif
+		if constexpr (std::is_same_v<typename Head::name, void>) {
+			return captures<Tail...>::template exists<Name>();
+		} else {
+			if constexpr (Head::name::name.is_same_as(Name)) {
+				return true;
+			} else {
+				return captures<Tail...>::template exists<Name>();
+			}
+		}
+	}
+	template <size_t id> CTRE_FORCE_INLINE constexpr auto & select() noexcept {
+		if constexpr (id == Head::get_id()) {
 			return head;
 		} else {
 			return captures<Tail...>::template select<id>();
@@ -2399,12 +3263,30 @@ template <> struct captures<> {
 
 template <typename Iterator, typename... Captures> class regex_results {
 	captures<captured_content<0>::template storage<Iterator>, typename Captures::template storage<Iterator>...> _captures{};
+	
+	template <typename, typename...> friend class regex_results;
+	
+	template <size_t Id, typename Other, typename Convert> constexpr CTRE_FORCE_INLINE void copy_capture(const Other & other, Convert convert) noexcept {
+		const auto & source = other._captures.template select<Id>();
+		auto & target = _captures.template select<Id>();
+		target.set_start(convert(source.begin()));
+		target.set_end(convert(source.end()));
+		if (source) {
+			target.matched();
+		}
+	}
 public:
-	using char_type = typename std::iterator_traits<Iterator>::value_type;
+	using char_type = typename subject_units<Iterator>::char_type;
 	
 	constexpr CTRE_FORCE_INLINE regex_results() noexcept { }
 	constexpr CTRE_FORCE_INLINE regex_results(not_matched_tag_t) noexcept { }
 	
+	// same results over another iterator of the subject (see utf8_iterator)
+	template <typename OtherIterator, typename Convert> constexpr CTRE_FORCE_INLINE regex_results(const regex_results<OtherIterator, Captures...> & other, Convert convert) noexcept {
+		copy_capture<0>(other, convert);
+		(copy_capture<Captures::template storage<Iterator>::get_id()>(other, convert), ...);
+	}
+	
 	// special constructor for deducting
 	constexpr CTRE_FORCE_INLINE regex_results(Iterator, ctll::list<Captures...>) noexcept { }
 	
@@ -2468,6 +3350,9 @@ public:
 		_captures.template select<0>().set_end(pos);
 		return *this;
 	}
+	constexpr CTRE_FORCE_INLINE Iterator get_start_position() const noexcept {
+		return _captures.template select<0>().begin();
+	}
 	constexpr CTRE_FORCE_INLINE Iterator get_end_position() const noexcept {
 		return _captures.template select<0>().get_end();
 	}
@@ -2556,7 +3441,15 @@ template <typename... Tail, typename Output> constexpr auto find_captures(ctll::
 	return find_captures(ctll::list<Tail...>(), output);
 }
 
-// , typename = std::enable_if_t<(MatchesCharacter<CharacterLike>::template value<char>)
+template <typename... Tail, typename Output> constexpr auto find_captures(ctll::list<assert_line_begin, Tail...>, Output output) noexcept {
+	return find_captures(ctll::list<Tail...>(), output);
+}
+
+template <typename... Tail, typename Output> constexpr auto find_captures(ctll::list<assert_line_end, Tail...>, Output output) noexcept {
+	return find_captures(ctll::list<Tail...>(), output);
+}
+
+// , typename = std::enable_if_t<(MatchesCharacter<CharacterLike>::template value<char>)
 template <typename CharacterLike, typename... Tail, typename Output> constexpr auto find_captures(ctll::list<CharacterLike, Tail...>, Output output) noexcept {
 	return find_captures(ctll::list<Tail...>(), output);
 }
@@ -2623,6 +3516,9 @@ template <size_t Id, typename Name, typename... Content, typename... Tail, typen
 namespace ctre {
 	
 struct can_be_anything {};
+
+// placed after the pattern to find out if it can match without consuming anything
+struct can_be_empty {};
 	
 
 template <typename... Content> 
@@ -2640,6 +3536,23 @@ constexpr auto first(ctll::list<Content...> l, ctll::list<end_mark, Tail...>) no
 	return l;
 }
 
+// depends on where the match started, repeats before it must keep backtracking
+template <typename... Content, typename... Tail> 
+constexpr auto first(ctll::list<Content...>, ctll::list<non_empty_end_mark, Tail...>) noexcept {
+	return ctll::list<can_be_anything>{};
+}
+
+template <typename... Content, typename... Tail> 
+constexpr auto first(ctll::list<Content...>, ctll::list<can_be_empty, Tail...>) noexcept {
+	return ctll::list<Content..., can_be_empty>{};
+}
+
+// pattern with syntax error (already reported by static_assert)
+template <typename... Content, typename... Tail> 
+constexpr auto first(ctll::list<Content...>, ctll::list<ctll::list<reject>, Tail...>) noexcept {
+	return ctll::list<can_be_anything>{};
+}
+
 template <typename... Content, typename... Tail> 
 constexpr auto first(ctll::list<Content...> l, ctll::list<end_cycle_mark, Tail...>) noexcept {
 	return l;
@@ -2672,6 +3585,17 @@ constexpr auto first(ctll::list<Content...> l, ctll::list<assert_end, Tail...>)
 	return l;
 }
 
+template <typename... Content, typename... Tail> 
+constexpr auto first(ctll::list<Content...> l, ctll::list<assert_line_begin, Tail...>) noexcept {
+	return first(l, ctll::list<Tail...>{});
+}
+
+// before the end of a line there is '\n' (or nothing)
+template <typename... Content, typename... Tail> 
+constexpr auto first(ctll::list<Content...>, ctll::list<assert_line_end, Tail...>) noexcept {
+	return ctll::list<Content..., character<'\n'>>{};
+}
+
 // sequence
 template <typename... Content, typename... Seq, typename... Tail> 
 constexpr auto first(ctll::list<Content...> l, ctll::list<sequence<Seq...>, Tail...>) noexcept {
@@ -2841,6 +3765,17 @@ constexpr auto first(ctll::list<Content...>, ctll::list<any, Tail...>) noexcept
 	return ctll::list<can_be_anything>{};
 }
 
+// properties
+template <typename... Content, uint32_t Categories, typename... Tail> 
+constexpr auto first(ctll::list<Content...>, ctll::list<category_property<Categories>, Tail...>) noexcept {
+	return ctll::list<Content..., category_property<Categories>>{};
+}
+
+template <typename... Content, typename... Tail> 
+constexpr auto first(ctll::list<Content...>, ctll::list<any_code_point_property, Tail...>) noexcept {
+	return ctll::list<Content..., any_code_point_property>{};
+}
+
 // negative
 template <typename... Content, typename... SetContent, typename... Tail> 
 constexpr auto first(ctll::list<Content...>, ctll::list<negate<SetContent...>, Tail...>) noexcept {
@@ -2913,6 +3848,19 @@ template <typename CB> constexpr int64_t negative_helper(ctre::enumeration<>, CB
 	return start;
 }
 
+// properties aren't ranges, nothing is excluded from the negation (a superset)
+template <uint32_t Categories, typename CB> constexpr int64_t negative_helper(ctre::category_property<Categories>, CB &, int64_t start) {
+	return start;
+}
+
+template <typename CB> constexpr int64_t negative_helper(ctre::any_code_point_property, CB &, int64_t start) {
+	return start;
+}
+
+template <typename... Content, typename CB> constexpr int64_t negative_helper(ctre::negate<Content...>, CB &, int64_t start) {
+	return start;
+}
+
 template <typename CB> constexpr int64_t negative_helper(ctre::set<>, CB &, int64_t start) {
 	return start;
 }
@@ -3034,6 +3982,12 @@ public:
 	constexpr bool check(can_be_anything) {
 		return used > 0;
 	}
+	template <uint32_t Categories> constexpr bool check(ctre::category_property<Categories>) {
+		return used > 0;
+	}
+	constexpr bool check(ctre::any_code_point_property) {
+		return used > 0;
+	}
 	template <typename... Content> constexpr bool check(ctre::negative_set<Content...> nset) {
 		bool collision = false;
 		negative_helper(nset, [&](int64_t low, int64_t high){
@@ -3041,6 +3995,9 @@ public:
 		});
 		return collision;
 	}
+	template <typename... Content> constexpr bool check(ctre::negate<Content...>) {
+		return check(ctre::negative_set<Content...>{});
+	}
 	template <auto... V> constexpr bool check(ctre::enumeration<V...>) {
 		
 		return (check(V,V) || ... || false);
@@ -3062,11 +4019,20 @@ public:
 	constexpr void populate(can_be_anything) {
 		insert(std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max());
 	}
+	template <uint32_t Categories> constexpr void populate(ctre::category_property<Categories>) {
+		insert(std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max());
+	}
+	constexpr void populate(ctre::any_code_point_property) {
+		insert(std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max());
+	}
 	template <typename... Content> constexpr void populate(ctre::negative_set<Content...> nset) {
 		negative_helper(nset, [&](int64_t low, int64_t high){
 			this->insert(low, high);
 		});
 	}
+	template <typename... Content> constexpr void populate(ctre::negate<Content...>) {
+		populate(ctre::negative_set<Content...>{});
+	}
 	template <typename... Content> constexpr void populate(ctre::set<Content...>) {
 		(populate(Content{}), ...);
 	}
@@ -3088,896 +4054,6974 @@ template <typename... A, typename... B> constexpr bool collides(ctll::list<A...>
 
 #endif
 
-// remove me when MSVC fix the constexpr bug
-#ifdef _MSC_VER
-#ifndef CTRE_MSVC_GREEDY_WORKAROUND
-#define CTRE_MSVC_GREEDY_WORKAROUND
-#endif
-#endif
+#ifndef CTRE__LEADING_STRING__HPP
+#define CTRE__LEADING_STRING__HPP
+
+#include <cstring>
 
 namespace ctre {
 
-// calling with pattern prepare stack and triplet of iterators
-template <typename Iterator, typename EndIterator, typename Pattern> 
-constexpr inline auto match_re(const Iterator begin, const EndIterator end, Pattern pattern) noexcept {
-	using return_type = decltype(regex_results(std::declval<Iterator>(), find_captures(pattern)));
-	return evaluate(begin, begin, end, return_type{}, ctll::list<start_mark, Pattern, assert_end, end_mark, accept>());
+// literal characters every match of the pattern starts with
+
+template <auto... Prefix>
+constexpr auto leading_string(string<Prefix...> out, ctll::list<>) noexcept {
+	return out;
 }
 
-template <typename Iterator, typename EndIterator, typename Pattern> 
-constexpr inline auto search_re(const Iterator begin, const EndIterator end, Pattern pattern) noexcept {
-	using return_type = decltype(regex_results(std::declval<Iterator>(), find_captures(pattern)));
-	
-	auto it = begin;
-	for (; end != it; ++it) {
-		if (auto out = evaluate(begin, it, end, return_type{}, ctll::list<start_mark, Pattern, end_mark, accept>())) {
-			return out;
-		}
-	}
-	
-	// in case the RE is empty
-	return evaluate(begin, it, end, return_type{}, ctll::list<start_mark, Pattern, end_mark, accept>());
+// anything which is not a plain literal ends the prefix
+template <auto... Prefix, typename Head, typename... Tail>
+constexpr auto leading_string(string<Prefix...> out, ctll::list<Head, Tail...>) noexcept {
+	return out;
 }
 
-// sink for making the errors shorter
-template <typename R, typename Iterator, typename EndIterator> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator, Iterator, const EndIterator, R, ...) noexcept {
-	return R{};
+// characters / strings
+template <auto... Prefix, auto V, typename... Tail>
+constexpr auto leading_string(string<Prefix...>, ctll::list<character<V>, Tail...>) noexcept {
+	return leading_string(string<Prefix..., V>{}, ctll::list<Tail...>{});
 }
 
-// if we found "accept" object on stack => ACCEPT
-template <typename R, typename Iterator, typename EndIterator> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator, Iterator, const EndIterator, R captures, ctll::list<accept>) noexcept {
-	return captures.matched();
+template <auto... Prefix, auto... String, typename... Tail>
+constexpr auto leading_string(string<Prefix...>, ctll::list<string<String...>, Tail...>) noexcept {
+	return leading_string(string<Prefix..., String...>{}, ctll::list<Tail...>{});
 }
 
-// if we found "reject" object on stack => REJECT
-template <typename R, typename... Rest, typename Iterator, typename EndIterator> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator, Iterator, const EndIterator, R, ctll::list<reject, Rest...>) noexcept {
-	return R{}; // just return not matched return type
+// sequence, captures, empty and begin assert don't consume anything by themselves
+template <auto... Prefix, typename... Seq, typename... Tail>
+constexpr auto leading_string(string<Prefix...> out, ctll::list<sequence<Seq...>, Tail...>) noexcept {
+	return leading_string(out, ctll::list<Seq..., Tail...>{});
 }
 
-// mark start of outer capture
-template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<start_mark, Tail...>) noexcept {
-	return evaluate(begin, current, end, captures.set_start_mark(current), ctll::list<Tail...>());
+template <auto... Prefix, size_t Id, typename... Seq, typename... Tail>
+constexpr auto leading_string(string<Prefix...> out, ctll::list<capture<Id, Seq...>, Tail...>) noexcept {
+	return leading_string(out, ctll::list<Seq..., Tail...>{});
 }
 
-// mark end of outer capture
-template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<end_mark, Tail...>) noexcept {
-	return evaluate(begin, current, end, captures.set_end_mark(current), ctll::list<Tail...>());
+template <auto... Prefix, size_t Id, typename Name, typename... Seq, typename... Tail>
+constexpr auto leading_string(string<Prefix...> out, ctll::list<capture_with_name<Id, Name, Seq...>, Tail...>) noexcept {
+	return leading_string(out, ctll::list<Seq..., Tail...>{});
 }
 
-// mark end of cycle
-template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator, Iterator current, const EndIterator, R captures, ctll::list<end_cycle_mark>) noexcept {
-	return captures.set_end_mark(current).matched();
+template <auto... Prefix, typename... Tail>
+constexpr auto leading_string(string<Prefix...> out, ctll::list<empty, Tail...>) noexcept {
+	return leading_string(out, ctll::list<Tail...>{});
 }
 
-// matching everything which behave as a one character matcher
+template <auto... Prefix, typename... Tail>
+constexpr auto leading_string(string<Prefix...> out, ctll::list<assert_begin, Tail...>) noexcept {
+	return leading_string(out, ctll::list<Tail...>{});
+}
 
-template <typename R, typename Iterator, typename EndIterator, typename CharacterLike, typename... Tail, typename = std::enable_if_t<(MatchesCharacter<CharacterLike>::template value<decltype(*std::declval<Iterator>())>)>> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<CharacterLike, Tail...>) noexcept {
-	if (end == current) return not_matched;
-	if (!CharacterLike::match_char(*current)) return not_matched;
-	return evaluate(begin, current+1, end, captures, ctll::list<Tail...>());
+template <auto... Prefix, typename... Tail>
+constexpr auto leading_string(string<Prefix...> out, ctll::list<assert_line_begin, Tail...>) noexcept {
+	return leading_string(out, ctll::list<Tail...>{});
 }
 
-// matching strings in patterns
+// first iteration of plus / repeat{A>0,} is mandatory, but the prefix ends with it
+template <auto... Prefix, typename... Seq, typename... Tail>
+constexpr auto leading_string(string<Prefix...> out, ctll::list<plus<Seq...>, Tail...>) noexcept {
+	return leading_string(out, ctll::list<Seq...>{});
+}
 
-template <typename Iterator> struct string_match_result {
-	Iterator current;
-	bool match;
-};
+template <auto... Prefix, typename... Seq, typename... Tail>
+constexpr auto leading_string(string<Prefix...> out, ctll::list<lazy_plus<Seq...>, Tail...>) noexcept {
+	return leading_string(out, ctll::list<Seq...>{});
+}
 
-template <auto Head, auto... String, typename Iterator, typename EndIterator> constexpr CTRE_FORCE_INLINE string_match_result<Iterator> evaluate_match_string(Iterator current, const EndIterator end) noexcept {
-	if ((end != current) && (Head == *current)) {
-		if constexpr (sizeof...(String) > 0) {
-			return evaluate_match_string<String...>(++current, end);
-		} else {
-			return {++current, true};
-		}
-	} else {
-		return {current, false}; // not needed but will optimize
-	}
+template <auto... Prefix, typename... Seq, typename... Tail>
+constexpr auto leading_string(string<Prefix...> out, ctll::list<possessive_plus<Seq...>, Tail...>) noexcept {
+	return leading_string(out, ctll::list<Seq...>{});
 }
 
-template <typename R, typename Iterator, typename EndIterator, auto... String, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<string<String...>, Tail...>) noexcept {
-	if constexpr (sizeof...(String) == 0) {
-		return evaluate(begin, current, end, captures, ctll::list<Tail...>());
-	} else if (auto tmp = evaluate_match_string<String...>(current, end); tmp.match) {
-		return evaluate(begin, tmp.current, end, captures, ctll::list<Tail...>());
-	} else {
-		return not_matched;
-	}
+template <auto... Prefix, size_t A, size_t B, typename... Seq, typename... Tail>
+constexpr auto leading_string(string<Prefix...> out, ctll::list<repeat<A, B, Seq...>, Tail...>) noexcept {
+	return leading_string(out, ctll::list<Seq...>{});
 }
 
-// matching select in patterns
-template <typename R, typename Iterator, typename EndIterator, typename HeadOptions, typename... TailOptions, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<select<HeadOptions, TailOptions...>, Tail...>) noexcept {
-	if (auto r = evaluate(begin, current, end, captures, ctll::list<HeadOptions, Tail...>())) {
-		return r;
-	} else {
-		return evaluate(begin, current, end, captures, ctll::list<select<TailOptions...>, Tail...>());
-	}
+template <auto... Prefix, size_t B, typename... Seq, typename... Tail>
+constexpr auto leading_string(string<Prefix...> out, ctll::list<repeat<0, B, Seq...>, Tail...>) noexcept {
+	return out;
 }
 
-template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator, Iterator, const EndIterator, R, ctll::list<select<>, Tail...>) noexcept {
-	// no previous option was matched => REJECT
-	return not_matched;
+template <auto... Prefix, size_t A, size_t B, typename... Seq, typename... Tail>
+constexpr auto leading_string(string<Prefix...> out, ctll::list<lazy_repeat<A, B, Seq...>, Tail...>) noexcept {
+	return leading_string(out, ctll::list<Seq...>{});
 }
 
-// matching optional in patterns
-template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<optional<Content...>, Tail...>) noexcept {
-	if (auto r1 = evaluate(begin, current, end, captures, ctll::list<sequence<Content...>, Tail...>())) {
-		return r1;
-	} else if (auto r2 = evaluate(begin, current, end, captures, ctll::list<Tail...>())) {
-		return r2;
-	} else {
-		return not_matched;
-	}
+template <auto... Prefix, size_t B, typename... Seq, typename... Tail>
+constexpr auto leading_string(string<Prefix...> out, ctll::list<lazy_repeat<0, B, Seq...>, Tail...>) noexcept {
+	return out;
 }
 
-// lazy optional
-template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<lazy_optional<Content...>, Tail...>) noexcept {
-	if (auto r1 = evaluate(begin, current, end, captures, ctll::list<Tail...>())) {
-		return r1;
-	} else if (auto r2 = evaluate(begin, current, end, captures, ctll::list<sequence<Content...>, Tail...>())) {
-		return r2;
-	} else {
-		return not_matched;
-	}
+template <auto... Prefix, size_t A, size_t B, typename... Seq, typename... Tail>
+constexpr auto leading_string(string<Prefix...> out, ctll::list<possessive_repeat<A, B, Seq...>, Tail...>) noexcept {
+	return leading_string(out, ctll::list<Seq...>{});
 }
 
-// matching sequence in patterns
-template <typename R, typename Iterator, typename EndIterator, typename HeadContent, typename... TailContent, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<sequence<HeadContent, TailContent...>, Tail...>) noexcept {
-	if constexpr (sizeof...(TailContent) > 0) {
-		return evaluate(begin, current, end, captures, ctll::list<HeadContent, sequence<TailContent...>, Tail...>());
-	} else {
-		return evaluate(begin, current, end, captures, ctll::list<HeadContent, Tail...>());
-	}
+template <auto... Prefix, size_t B, typename... Seq, typename... Tail>
+constexpr auto leading_string(string<Prefix...> out, ctll::list<possessive_repeat<0, B, Seq...>, Tail...>) noexcept {
+	return out;
 }
 
-// matching empty in patterns
-template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<empty, Tail...>) noexcept {
-	return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+// user facing interface
+template <typename... Content> constexpr auto calculate_leading_string(Content...) noexcept {
+	return leading_string(string<>{}, ctll::list<Content...>{});
 }
 
-// matching asserts
-template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<assert_begin, Tail...>) noexcept {
-	if (begin != current) {
-		return not_matched;
-	}
-	return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+template <auto... String> constexpr size_t string_length(string<String...>) noexcept {
+	return sizeof...(String);
 }
 
-template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<assert_end, Tail...>) noexcept {
-	if (end != current) {
-		return not_matched;
+// locating the prefix in the subject
+
+struct zero_terminated_string_end_iterator;
+
+template <typename Iterator> static inline constexpr bool is_byte_pointer_v = std::is_pointer_v<Iterator> && (sizeof(std::remove_pointer_t<Iterator>) == 1) && std::is_integral_v<std::remove_cv_t<std::remove_pointer_t<Iterator>>>;
+
+// byte comparison must never reject what `==` in evaluate() accepts
+template <auto V> constexpr bool is_byte_character() noexcept {
+	if constexpr (std::is_same_v<decltype(V), char>) {
+		return true;
+	} else {
+		return static_cast<int64_t>(V) >= 0 && static_cast<int64_t>(V) <= 127;
 	}
-	return evaluate(begin, current, end, captures, ctll::list<Tail...>());
 }
 
-// lazy repeat
-template <typename R, typename Iterator, typename EndIterator, size_t A, size_t B, typename... Content, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<lazy_repeat<A,B,Content...>, Tail...>) noexcept {
-	// A..B
-	size_t i{0};
-	for (; i < A && (A != 0); ++i) {
-		if (auto outer_result = evaluate(begin, current, end, captures, ctll::list<sequence<Content...>, end_cycle_mark>())) {
-			captures = outer_result.unmatch();
-			current = outer_result.get_end_position();
-		} else {
-			return not_matched;
+template <auto... String> struct string_bytes {
+	static constexpr unsigned char value[sizeof...(String)] = {static_cast<unsigned char>(String)...};
+};
+
+template <typename Iterator> inline bool find_bytes(Iterator & current, const Iterator end, const unsigned char * needle, size_t size) noexcept {
+	const auto * first = reinterpret_cast<const unsigned char *>(current);
+	const auto * last = reinterpret_cast<const unsigned char *>(end);
+	while (static_cast<size_t>(last - first) >= size) {
+		const auto * found = static_cast<const unsigned char *>(std::memchr(first, needle[0], static_cast<size_t>(last - first) - (size - 1)));
+		if (!found) {
+			return false;
+		} else if (std::memcmp(found + 1, needle + 1, size - 1) == 0) {
+			current += (found - reinterpret_cast<const unsigned char *>(current));
+			return true;
 		}
+		first = found + 1;
 	}
-	
-	if (auto outer_result = evaluate(begin, current, end, captures, ctll::list<Tail...>())) {
-		return outer_result;
-	} else {
-		for (; (i < B) || (B == 0); ++i) {
-			if (auto inner_result = evaluate(begin, current, end, captures, ctll::list<sequence<Content...>, end_cycle_mark>())) {
-				if (auto outer_result = evaluate(begin, inner_result.get_end_position(), end, inner_result.unmatch(), ctll::list<Tail...>())) {
-					return outer_result;
-				} else {
-					captures = inner_result.unmatch();
-					current = inner_result.get_end_position();
-					continue;
-				}
-			} else {
-				return not_matched;
-			}
+	return false;
+}
+
+// needle must not contain zero as terminator is the end of the subject
+template <typename Iterator> inline bool find_bytes_zero_terminated(Iterator & current, const unsigned char * needle, size_t size) noexcept {
+	const auto * first = reinterpret_cast<const char *>(current);
+	while ((first = std::strchr(first, static_cast<char>(needle[0]))) != nullptr) {
+		size_t i = 1;
+		while (i < size && static_cast<unsigned char>(first[i]) == needle[i]) {
+			++i;
 		}
-		return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+		if (i == size) {
+			current += (first - reinterpret_cast<const char *>(current));
+			return true;
+		}
+		++first;
 	}
+	return false;
 }
 
-// possessive repeat
-template <typename R, typename Iterator, typename EndIterator, size_t A, size_t B, typename... Content, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<possessive_repeat<A,B,Content...>, Tail...>) noexcept {
+template <auto... String, typename Iterator, typename EndIterator> constexpr CTRE_FORCE_INLINE bool starts_with_string([[maybe_unused]] Iterator current, [[maybe_unused]] const EndIterator end) noexcept {
+	return (((end != current) && (String == *current) && (++current, true)) && ... && true);
+}
 
-	for (size_t i{0}; (i < B) || (B == 0); ++i) {
-		// try as many of inner as possible and then try outer once
-		if (auto inner_result = evaluate(begin, current, end, captures, ctll::list<sequence<Content...>, end_cycle_mark>())) {
-			captures = inner_result.unmatch();
-			current = inner_result.get_end_position();
-		} else {
-			if (i < A && (A != 0)) return not_matched;
-			else return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+// move `current` to the next position where the prefix starts, returns false if there is none
+template <auto Head, auto... Tail, typename Iterator, typename EndIterator>
+constexpr CTRE_FORCE_INLINE bool find_leading_string(Iterator & current, const EndIterator end, string<Head, Tail...>) noexcept {
+	if constexpr (is_byte_pointer_v<Iterator> && is_byte_character<Head>() && (is_byte_character<Tail>() && ... && true)) {
+		if (!CTRE_IS_CONSTANT_EVALUATED()) {
+			if constexpr (std::is_same_v<Iterator, EndIterator>) {
+				return find_bytes(current, end, string_bytes<Head, Tail...>::value, 1 + sizeof...(Tail));
+			} else if constexpr (std::is_same_v<EndIterator, zero_terminated_string_end_iterator> && (static_cast<unsigned char>(Head) != 0) && ((static_cast<unsigned char>(Tail) != 0) && ... && true)) {
+				return find_bytes_zero_terminated(current, string_bytes<Head, Tail...>::value, 1 + sizeof...(Tail));
+			}
 		}
 	}
-	
-	return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+	for (; end != current; ++current) {
+		if ((Head == *current) && starts_with_string<Tail...>(current+1, end)) {
+			return true;
+		}
+	}
+	return false;
+}
+
 }
 
-// (gready) repeat
-template <typename R, typename Iterator, typename EndIterator, size_t A, size_t B, typename... Content, typename... Tail> 
-#ifdef CTRE_MSVC_GREEDY_WORKAROUND
-constexpr inline void evaluate_recursive(R & result, size_t i, const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<repeat<A,B,Content...>, Tail...> stack) {
-#else
-constexpr inline R evaluate_recursive(size_t i, const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<repeat<A,B,Content...>, Tail...> stack) {
 #endif
-	if ((B == 0) || (i < B)) {
-		 
-		// a*ab
-		// aab
-		
-		if (auto inner_result = evaluate(begin, current, end, captures, ctll::list<sequence<Content...>, end_cycle_mark>())) {
-			// TODO MSVC issue:
-			// if I uncomment this return it will not fail in constexpr (but the matching result will not be correct)
-			//  return inner_result
-			// I tried to add all constructors to R but without any success 
-			#ifdef CTRE_MSVC_GREEDY_WORKAROUND
-			evaluate_recursive(result, i+1, begin, inner_result.get_end_position(), end, inner_result.unmatch(), stack);
-			if (result) {
-				return;
+
+#ifndef CTRE__SIMD__HPP
+#define CTRE__SIMD__HPP
+
+// define CTRE_DISABLE_SIMD to keep only the scalar versions of byte scanning
+#ifndef CTRE_DISABLE_SIMD
+#if defined(__AVX2__)
+#define CTRE_SIMD_AVX2
+#endif
+#if defined(__SSSE3__) || defined(__AVX2__)
+#define CTRE_SIMD_SSSE3
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CTRE_SIMD_SSE2
+#endif
+#endif
+
+#ifdef CTRE_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef CTRE_SIMD_SSSE3
+#include <tmmintrin.h>
+#endif
+#ifdef CTRE_SIMD_AVX2
+#include <immintrin.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include <cstdint>
+#include <cstring>
+
+namespace ctre {
+
+// 256-bit set of byte values
+struct byte_set {
+	uint64_t bits[4]{};
+
+	constexpr void insert(unsigned char c) noexcept {
+		bits[c >> 6] |= uint64_t(1) << (c & 63u);
+	}
+	constexpr bool test(unsigned char c) const noexcept {
+		return (bits[c >> 6] >> (c & 63u)) & 1u;
+	}
+	constexpr size_t count() const noexcept {
+		size_t result{0};
+		for (unsigned c = 0; c < 256; ++c) {
+			result += test(static_cast<unsigned char>(c));
+		}
+		return result;
+	}
+	constexpr bool full() const noexcept {
+		return count() == 256;
+	}
+	constexpr byte_set complement() const noexcept {
+		return byte_set{{~bits[0], ~bits[1], ~bits[2], ~bits[3]}};
+	}
+};
+
+// all byte values of CharT accepted by the character-like types
+template <typename CharT, typename... Content> constexpr byte_set make_byte_set(ctll::list<Content...>) noexcept {
+	byte_set out;
+	for (unsigned c = 0; c < 256; ++c) {
+		if ((Content::match_char(static_cast<CharT>(c)) || ... || false)) {
+			out.insert(static_cast<unsigned char>(c));
+		}
+	}
+	return out;
+}
+
+// byte_set lowered into tables for the vector kernels
+struct byte_scanner {
+	static constexpr size_t max_ranges = 3;
+
+	byte_set set{};
+	// set as contiguous ranges [low, low+span] (if there is only a few of them)
+	size_t ranges{0};
+	unsigned char low[max_ranges]{};
+	unsigned char span[max_ranges]{};
+	// nibble tables: c is in set if (nibble_low[c & 15] & nibble_high[c >> 4]) != 0
+	// (exact with up to 8 distinct rows, superset otherwise)
+	unsigned char nibble_low[16]{};
+	unsigned char nibble_high[16]{};
+	bool nibble_exact{true};
+
+	constexpr byte_scanner() noexcept { }
+	constexpr byte_scanner(byte_set s) noexcept: set{s} {
+		size_t count{0};
+		for (unsigned c = 0; c < 256; ++c) {
+			if (set.test(static_cast<unsigned char>(c)) && (c == 0 || !set.test(static_cast<unsigned char>(c-1)))) {
+				unsigned e = c;
+				while (e < 255 && set.test(static_cast<unsigned char>(e+1))) ++e;
+				if (count < max_ranges) {
+					low[count] = static_cast<unsigned char>(c);
+					span[count] = static_cast<unsigned char>(e - c);
+				}
+				++count;
 			}
-			#else
-			if (auto rec_result = evaluate_recursive(i+1, begin, inner_result.get_end_position(), end, inner_result.unmatch(), stack)) {
-				return rec_result;
+		}
+		ranges = count;
+
+		uint16_t rows[16]{};
+		for (unsigned c = 0; c < 256; ++c) {
+			if (set.test(static_cast<unsigned char>(c))) rows[c >> 4] |= static_cast<uint16_t>(1u << (c & 15u));
+		}
+		uint16_t buckets[8]{};
+		size_t used{0};
+		for (unsigned h = 0; h < 16; ++h) {
+			if (rows[h] == 0) continue;
+			size_t b = 0;
+			while (b < used && buckets[b] != rows[h]) ++b;
+			if (b == used) {
+				if (used < 8) {
+					buckets[used++] = rows[h];
+				} else {
+					// out of buckets => merge into the last one
+					b = 7;
+					buckets[7] |= rows[h];
+					nibble_exact = false;
+				}
 			}
-			#endif
+			nibble_high[h] = static_cast<unsigned char>(1u << b);
 		}
-	} 
-	#ifdef CTRE_MSVC_GREEDY_WORKAROUND
-	result = evaluate(begin, current, end, captures, ctll::list<Tail...>());
-	#else
-	return evaluate(begin, current, end, captures, ctll::list<Tail...>());
-	#endif
-}	
+		for (unsigned l = 0; l < 16; ++l) {
+			for (size_t b = 0; b < used; ++b) {
+				if ((buckets[b] >> l) & 1u) nibble_low[l] = static_cast<unsigned char>(nibble_low[l] | (1u << b));
+			}
+		}
+	}
+};
 
-// (gready) repeat optimization
-// basic one, if you are at the end of RE, just change it into possessive
-// TODO do the same if there is no collision with rest of the RE
-template <typename R, typename Iterator, typename EndIterator, size_t A, size_t B, typename... Content, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<repeat<A,B,Content...>,assert_end, Tail...>) {
-	return evaluate(begin, current, end, captures, ctll::list<possessive_repeat<A,B,Content...>, assert_end, Tail...>());
+inline unsigned count_trailing_zeros(uint32_t value) noexcept {
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, value);
+	return static_cast<unsigned>(index);
+#else
+	return static_cast<unsigned>(__builtin_ctz(value));
+#endif
 }
 
-template <typename... T> struct identify_type;
-
-// (greedy) repeat 
-template <typename R, typename Iterator, typename EndIterator, size_t A, size_t B, typename... Content, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, [[maybe_unused]] ctll::list<repeat<A,B,Content...>, Tail...> stack) {
-	// check if it can be optimized
-#ifndef CTRE_DISABLE_GREEDY_OPT
-	if constexpr (collides(calculate_first(Content{}...), calculate_first(Tail{}...))) {
-#endif
-		// A..B
-		size_t i{0};
-		for (; i < A && (A != 0); ++i) {
-			if (auto inner_result = evaluate(begin, current, end, captures, ctll::list<sequence<Content...>, end_cycle_mark>())) {
-				captures = inner_result.unmatch();
-				current = inner_result.get_end_position();
+#ifdef CTRE_SIMD_SSE2
+template <const byte_scanner & Scanner> inline __m128i match_bytes_sse(__m128i data) noexcept {
+	if constexpr (Scanner.ranges <= byte_scanner::max_ranges) {
+		__m128i result = _mm_setzero_si128();
+		for (size_t i = 0; i < Scanner.ranges; ++i) {
+			if (Scanner.span[i] == 0) {
+				result = _mm_or_si128(result, _mm_cmpeq_epi8(data, _mm_set1_epi8(static_cast<char>(Scanner.low[i]))));
 			} else {
-				return not_matched;
+				// (c - low) <= span as unsigned
+				const __m128i shifted = _mm_sub_epi8(data, _mm_set1_epi8(static_cast<char>(Scanner.low[i])));
+				result = _mm_or_si128(result, _mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_set1_epi8(static_cast<char>(Scanner.span[i]))), shifted));
 			}
 		}
-	#ifdef CTRE_MSVC_GREEDY_WORKAROUND
-		R result;
-		evaluate_recursive(result, i, begin, current, end, captures, stack);
 		return result;
-	#else
-		return evaluate_recursive(i, begin, current, end, captures, stack);
-	#endif
-#ifndef CTRE_DISABLE_GREEDY_OPT
 	} else {
-		// if there is no collision we can go possessive
-		return evaluate(begin, current, end, captures, ctll::list<possessive_repeat<A,B,Content...>, Tail...>());
+#ifdef CTRE_SIMD_SSSE3
+		const __m128i low_table = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Scanner.nibble_low));
+		const __m128i high_table = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Scanner.nibble_high));
+		const __m128i nibble = _mm_set1_epi8(0x0F);
+		const __m128i low = _mm_shuffle_epi8(low_table, _mm_and_si128(data, nibble));
+		const __m128i high = _mm_shuffle_epi8(high_table, _mm_and_si128(_mm_srli_epi16(data, 4), nibble));
+		const __m128i zero = _mm_setzero_si128();
+		return _mm_andnot_si128(_mm_cmpeq_epi8(_mm_and_si128(low, high), zero), _mm_cmpeq_epi8(zero, zero));
+#else
+		return data;
+#endif
 	}
+}
 #endif
 
+#ifdef CTRE_SIMD_AVX2
+template <const byte_scanner & Scanner> inline __m256i match_bytes_avx(__m256i data) noexcept {
+	if constexpr (Scanner.ranges <= byte_scanner::max_ranges) {
+		__m256i result = _mm256_setzero_si256();
+		for (size_t i = 0; i < Scanner.ranges; ++i) {
+			if (Scanner.span[i] == 0) {
+				result = _mm256_or_si256(result, _mm256_cmpeq_epi8(data, _mm256_set1_epi8(static_cast<char>(Scanner.low[i]))));
+			} else {
+				const __m256i shifted = _mm256_sub_epi8(data, _mm256_set1_epi8(static_cast<char>(Scanner.low[i])));
+				result = _mm256_or_si256(result, _mm256_cmpeq_epi8(_mm256_min_epu8(shifted, _mm256_set1_epi8(static_cast<char>(Scanner.span[i]))), shifted));
+			}
+		}
+		return result;
+	} else {
+		const __m256i low_table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(Scanner.nibble_low)));
+		const __m256i high_table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(Scanner.nibble_high)));
+		const __m256i nibble = _mm256_set1_epi8(0x0F);
+		const __m256i low = _mm256_shuffle_epi8(low_table, _mm256_and_si256(data, nibble));
+		const __m256i high = _mm256_shuffle_epi8(high_table, _mm256_and_si256(_mm256_srli_epi16(data, 4), nibble));
+		const __m256i zero = _mm256_setzero_si256();
+		return _mm256_andnot_si256(_mm256_cmpeq_epi8(_mm256_and_si256(low, high), zero), _mm256_cmpeq_epi8(zero, zero));
+	}
 }
+#endif
 
-// repeat lazy_star
-template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<lazy_star<Content...>, Tail...>) noexcept {
-	return evaluate(begin, current, end, captures, ctll::list<lazy_repeat<0,0,Content...>, Tail...>());
-}
+// vector kernels need either a few ranges or pshufb
+template <const byte_scanner & Scanner> static inline constexpr bool has_vector_scan_v =
+#if defined(CTRE_SIMD_SSSE3)
+	true;
+#elif defined(CTRE_SIMD_SSE2)
+	Scanner.ranges <= byte_scanner::max_ranges;
+#else
+	false;
+#endif
 
-// repeat (lazy_plus)
-template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<lazy_plus<Content...>, Tail...>) noexcept {
-	return evaluate(begin, current, end, captures, ctll::list<lazy_repeat<1,0,Content...>, Tail...>());
+// lowest candidate from a vector mask which is really in the set (nibble tables can be a superset)
+template <const byte_scanner & Scanner> inline const unsigned char * first_in_mask(const unsigned char * block, uint32_t mask) noexcept {
+	if constexpr (Scanner.ranges > byte_scanner::max_ranges && !Scanner.nibble_exact) {
+		for (; mask; mask &= mask - 1) {
+			const unsigned char * candidate = block + count_trailing_zeros(mask);
+			if (Scanner.set.test(*candidate)) return candidate;
+		}
+		return nullptr;
+	} else {
+		return block + count_trailing_zeros(mask);
+	}
 }
 
-// repeat (possessive_star)
-template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<possessive_star<Content...>, Tail...>) noexcept {
-	return evaluate(begin, current, end, captures, ctll::list<possessive_repeat<0,0,Content...>, Tail...>());
+// first byte in [current, end) which is member of the set (or `end`)
+template <const byte_scanner & Scanner> inline const unsigned char * scan_bytes(const unsigned char * current, const unsigned char * end) noexcept {
+	if constexpr (Scanner.ranges == 1 && Scanner.span[0] == 0) {
+		const void * found = std::memchr(current, Scanner.low[0], static_cast<size_t>(end - current));
+		return found ? static_cast<const unsigned char *>(found) : end;
+	} else {
+		if constexpr (has_vector_scan_v<Scanner>) {
+#ifdef CTRE_SIMD_AVX2
+			for (; end - current >= 32; current += 32) {
+				const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(current));
+				if (const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(match_bytes_avx<Scanner>(data)))) {
+					if (auto found = first_in_mask<Scanner>(current, mask)) return found;
+				}
+			}
+#endif
+#ifdef CTRE_SIMD_SSE2
+			for (; end - current >= 16; current += 16) {
+				const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(current));
+				if (const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(match_bytes_sse<Scanner>(data)))) {
+					if (auto found = first_in_mask<Scanner>(current, mask)) return found;
+				}
+			}
+#endif
+		}
+		while (current != end && !Scanner.set.test(*current)) {
+			++current;
+		}
+		return current;
+	}
 }
 
-// repeat (possessive_plus)
-template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<possessive_plus<Content...>, Tail...>) noexcept {
-	return evaluate(begin, current, end, captures, ctll::list<possessive_repeat<1,0,Content...>, Tail...>());
 }
 
-// repeat (greedy) star
-template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<star<Content...>, Tail...>) noexcept {
-	return evaluate(begin, current, end, captures, ctll::list<repeat<0,0,Content...>, Tail...>());
-}
+#endif
 
-// repeat (greedy) plus
-template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<plus<Content...>, Tail...>) noexcept {
-	return evaluate(begin, current, end, captures, ctll::list<repeat<1,0,Content...>, Tail...>());
-}
+#ifndef CTRE__UTF8__HPP
+#define CTRE__UTF8__HPP
 
-// capture (numeric ID)
-template <typename R, typename Iterator, typename EndIterator, size_t Id, typename... Content, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<capture<Id, Content...>, Tail...>) noexcept {
-	return evaluate(begin, current, end, captures.template start_capture<Id>(current), ctll::list<sequence<Content...>, numeric_mark<Id>, Tail...>());
-}
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
 
-// capture end mark (numeric and string ID)
-template <typename R, typename Iterator, typename EndIterator, size_t Id, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<numeric_mark<Id>, Tail...>) noexcept {
-	return evaluate(begin, current, end, captures.template end_capture<Id>(current), ctll::list<Tail...>());
+namespace ctre {
+
+struct utf8_code_point {
+	char32_t value;
+	unsigned length;
+};
+
+// malformed and truncated sequences are one U+FFFD per byte
+constexpr utf8_code_point decode_utf8(const char * ptr, const char * end) noexcept {
+	constexpr utf8_code_point replacement{0xFFFD, 1};
+	const unsigned char first = static_cast<unsigned char>(ptr[0]);
+	unsigned length{0};
+	char32_t value{0};
+	// range of the second byte (overlong forms, surrogates and values after U+10FFFF are excluded)
+	unsigned char low{0x80};
+	unsigned char high{0xBF};
+	if (first < 0x80) {
+		return {first, 1};
+	} else if (first < 0xC2) {
+		return replacement;
+	} else if (first < 0xE0) {
+		length = 2;
+		value = first & 0x1Fu;
+	} else if (first < 0xF0) {
+		length = 3;
+		value = first & 0x0Fu;
+		low = (first == 0xE0) ? 0xA0 : 0x80;
+		high = (first == 0xED) ? 0x9F : 0xBF;
+	} else if (first < 0xF5) {
+		length = 4;
+		value = first & 0x07u;
+		low = (first == 0xF0) ? 0x90 : 0x80;
+		high = (first == 0xF4) ? 0x8F : 0xBF;
+	} else {
+		return replacement;
+	}
+	if (end - ptr < static_cast<std::ptrdiff_t>(length)) {
+		return replacement;
+	}
+	for (unsigned i = 1; i != length; ++i) {
+		const unsigned char unit = static_cast<unsigned char>(ptr[i]);
+		if (unit < low || unit > high) {
+			return replacement;
+		}
+		low = 0x80;
+		high = 0xBF;
+		value = (value << 6) | (unit & 0x3Fu);
+	}
+	return {value, length};
+}
+
+// first byte which isn't ASCII (64 bytes per step)
+inline const char * find_non_ascii(const char * ptr, const char * end) noexcept {
+#if defined(CTRE_SIMD_AVX2)
+	for (; end - ptr >= 64; ptr += 64) {
+		const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+		const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr + 32));
+		if (_mm256_movemask_epi8(_mm256_or_si256(a, b)) != 0) break;
+	}
+#elif defined(CTRE_SIMD_SSE2)
+	for (; end - ptr >= 64; ptr += 64) {
+		const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+		const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr + 16));
+		const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr + 32));
+		const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr + 48));
+		if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))) != 0) break;
+	}
+	for (; end - ptr >= 16; ptr += 16) {
+		const int mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr)));
+		if (mask != 0) {
+			return ptr + count_trailing_zeros(static_cast<uint32_t>(mask));
+		}
+	}
+#endif
+	for (; ptr != end; ++ptr) {
+		if (static_cast<unsigned char>(*ptr) >= 0x80) break;
+	}
+	return ptr;
 }
 
-// capture (string ID)
-template <typename R, typename Iterator, typename EndIterator, size_t Id, typename Name, typename... Content, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<capture_with_name<Id, Name, Content...>, Tail...>) noexcept {
-	return evaluate(begin, current, end, captures.template start_capture<Id>(current), ctll::list<sequence<Content...>, numeric_mark<Id>, Tail...>());
+constexpr bool is_ascii(const char * ptr, const char * end) noexcept {
+	if (!CTRE_IS_CONSTANT_EVALUATED()) {
+		return find_non_ascii(ptr, end) == end;
+	}
+	for (; ptr != end; ++ptr) {
+		if (static_cast<unsigned char>(*ptr) >= 0x80) return false;
+	}
+	return true;
 }
 
-// backreference support (match agains content of iterators)
-template <typename Iterator, typename EndIterator> constexpr CTRE_FORCE_INLINE string_match_result<Iterator> match_against_range(Iterator current, const EndIterator end, Iterator range_current, const Iterator range_end) noexcept {
-	while (end != current && range_end != range_current) {
-		if (*current == *range_current) {
-			current++;
-			range_current++;
+// code points of UTF-8 encoded bytes, captures still point into the bytes (`to_view()` is a view of them)
+struct utf8_iterator {
+	using value_type = char32_t;
+	using difference_type = std::ptrdiff_t;
+	using pointer = void;
+	using reference = char32_t;
+	using iterator_category = std::forward_iterator_tag;
+	
+	const char * ptr{nullptr};
+	const char * end{nullptr};
+	// rest of the subject is ASCII, so it can be matched as bytes (see utf8_range)
+	bool ascii{false};
+	
+	constexpr utf8_iterator() noexcept = default;
+	constexpr utf8_iterator(const char * p, const char * e, bool a = false) noexcept: ptr{p}, end{e}, ascii{a} { }
+	
+	constexpr CTRE_FORCE_INLINE char32_t operator*() const noexcept {
+		const unsigned char first = static_cast<unsigned char>(*ptr);
+		if (first < 0x80) {
+			return first;
+		}
+		return decode_utf8(ptr, end).value;
+	}
+	constexpr CTRE_FORCE_INLINE utf8_iterator & operator++() noexcept {
+		if (static_cast<unsigned char>(*ptr) < 0x80) {
+			++ptr;
 		} else {
-			return {current, false};
+			ptr += decode_utf8(ptr, end).length;
 		}
+		return *this;
 	}
-	return {current, range_current == range_end};
-}
+	constexpr CTRE_FORCE_INLINE utf8_iterator operator++(int) noexcept {
+		utf8_iterator previous = *this;
+		++*this;
+		return previous;
+	}
+	// evaluation steps over characters with `current + 1`
+	friend constexpr CTRE_FORCE_INLINE utf8_iterator operator+(utf8_iterator it, difference_type steps) noexcept {
+		for (; steps > 0; --steps) ++it;
+		return it;
+	}
+	friend constexpr CTRE_FORCE_INLINE bool operator==(const utf8_iterator & lhs, const utf8_iterator & rhs) noexcept {
+		return lhs.ptr == rhs.ptr;
+	}
+	friend constexpr CTRE_FORCE_INLINE bool operator!=(const utf8_iterator & lhs, const utf8_iterator & rhs) noexcept {
+		return lhs.ptr != rhs.ptr;
+	}
+};
 
-// backreference with name
-template <typename R, typename Id, typename Iterator, typename EndIterator, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<back_reference_with_name<Id>, Tail...>) noexcept {
+template <> struct subject_units<utf8_iterator> {
+	using char_type = char;
 	
-	if (const auto ref = captures.template get<Id>()) {
-		if (auto tmp = match_against_range(current, end, ref.begin(), ref.end()); tmp.match) {
-			return evaluate(begin, tmp.current, end, captures, ctll::list<Tail...>());
-		}
+	static constexpr CTRE_FORCE_INLINE const char * data(utf8_iterator begin) noexcept {
+		return begin.ptr;
 	}
-	return not_matched;
-}
+	static constexpr CTRE_FORCE_INLINE size_t size(utf8_iterator begin, utf8_iterator end) noexcept {
+		return static_cast<size_t>(end.ptr - begin.ptr);
+	}
+	static CTRE_FORCE_INLINE auto to_string(utf8_iterator begin, utf8_iterator end) {
+		return std::string(begin.ptr, size(begin, end));
+	}
+};
 
-// backreference
-template <typename R, size_t Id, typename Iterator, typename EndIterator, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<back_reference<Id>, Tail...>) noexcept {
+// UTF-8 subject for match/search/range, the bytes are checked once for being only ASCII
+struct utf8_range {
+	const char * _begin;
+	const char * _end;
+	bool _ascii;
 	
-	if (const auto ref = captures.template get<Id>()) {
-		if (auto tmp = match_against_range(current, end, ref.begin(), ref.end()); tmp.match) {
-			return evaluate(begin, tmp.current, end, captures, ctll::list<Tail...>());
-		}
+	constexpr utf8_range(std::string_view subject) noexcept: _begin{subject.data()}, _end{subject.data() + subject.size()}, _ascii{is_ascii(_begin, _end)} { }
+	
+	constexpr utf8_iterator begin() const noexcept {
+		return utf8_iterator{_begin, _end, _ascii};
 	}
-	return not_matched;
+	constexpr utf8_iterator end() const noexcept {
+		return utf8_iterator{_end, _end, _ascii};
+	}
+};
+
 }
 
-// end of lookahead
-template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator, Iterator, const EndIterator, R captures, ctll::list<end_lookahead_mark>) noexcept {
-	return captures.matched();
+#endif
+
+#ifndef CTRE__FIRST_CHARACTERS__HPP
+#define CTRE__FIRST_CHARACTERS__HPP
+
+namespace ctre {
+
+// characters a match can start with (contains can_be_empty if the pattern can match empty)
+template <typename Pattern> constexpr auto calculate_first_characters(Pattern) noexcept {
+	return first(ctll::list<>{}, ctll::list<Pattern, can_be_empty>{});
 }
 
-// lookahead positive
-template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<lookahead_positive<Content...>, Tail...>) noexcept {
-	
-	if (auto lookahead_result = evaluate(begin, current, end, captures, ctll::list<sequence<Content...>, end_lookahead_mark>())) {
-		captures = lookahead_result.unmatch();
-		return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+template <typename... Content> constexpr bool has_usable_first_characters(ctll::list<Content...>) noexcept {
+	return !((std::is_same_v<Content, can_be_anything> || std::is_same_v<Content, can_be_empty>) || ... || false);
+}
+
+template <typename CharT, typename First> struct first_byte_scanner {
+	static constexpr byte_scanner value = byte_scanner(make_byte_set<CharT>(First{}));
+};
+
+template <typename CharT, typename... Content> constexpr CTRE_FORCE_INLINE bool is_first_character(CharT c, ctll::list<Content...>) noexcept {
+	if constexpr (sizeof(CharT) == 1 && std::is_integral_v<CharT>) {
+		return first_byte_scanner<CharT, ctll::list<Content...>>::value.set.test(static_cast<unsigned char>(c));
 	} else {
-		return not_matched;
+		return (Content::match_char(c) || ... || false);
 	}
 }
 
-// lookahead negative
-template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
-constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<lookahead_negative<Content...>, Tail...>) noexcept {
-	
-	if (auto lookahead_result = evaluate(begin, current, end, captures, ctll::list<sequence<Content...>, end_lookahead_mark>())) {
-		return not_matched;
+// move `current` to the next character which can start a match, returns false (and `current` is at the end) if there is none
+template <typename Iterator, typename EndIterator, typename... Content>
+constexpr CTRE_FORCE_INLINE bool find_first_character(Iterator & current, const EndIterator end, ctll::list<Content...>) noexcept {
+	using char_type = std::remove_cv_t<std::remove_reference_t<decltype(*current)>>;
+	if constexpr (sizeof(char_type) == 1 && std::is_integral_v<char_type>) {
+		using scanner = first_byte_scanner<char_type, ctll::list<Content...>>;
+		if constexpr (is_byte_pointer_v<Iterator> && std::is_same_v<Iterator, EndIterator>) {
+			if (!CTRE_IS_CONSTANT_EVALUATED()) {
+				const auto * data = reinterpret_cast<const unsigned char *>(current);
+				current += (scan_bytes<scanner::value>(data, reinterpret_cast<const unsigned char *>(end)) - data);
+				return current != end;
+			}
+		}
+		for (; end != current; ++current) {
+			if (scanner::value.set.test(static_cast<unsigned char>(*current))) return true;
+		}
+		return false;
 	} else {
-		return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+		for (; end != current; ++current) {
+			if ((Content::match_char(*current) || ... || false)) return true;
+		}
+		return false;
 	}
 }
 
-// property matching
-
 }
 
 #endif
 
-#ifndef CTRE__WRAPPER__HPP
-#define CTRE__WRAPPER__HPP
+#ifndef CTRE__FIXED_SHAPE__HPP
+#define CTRE__FIXED_SHAPE__HPP
 
-#include <string_view>
-#include <string>
+#include <cstdint>
+
+// longest fixed shape checked at once
+#ifndef CTRE_FIXED_SHAPE_MAX_WIDTH
+#define CTRE_FIXED_SHAPE_MAX_WIDTH 64
+#endif
 
 namespace ctre {
-	
-struct zero_terminated_string_end_iterator {
-	constexpr inline zero_terminated_string_end_iterator() = default;
-	constexpr CTRE_FORCE_INLINE bool operator==(const char * ptr) const noexcept {
-		return *ptr == '\0';
-	} 
-	constexpr CTRE_FORCE_INLINE bool operator==(const wchar_t * ptr) const noexcept {
-		return *ptr == 0;
-	} 
-	constexpr CTRE_FORCE_INLINE bool operator!=(const char * ptr) const noexcept {
-		return *ptr != '\0';
-	} 
-	constexpr CTRE_FORCE_INLINE bool operator!=(const wchar_t * ptr) const noexcept {
-		return *ptr != 0;
-	} 
-};
 
-template <typename T> class RangeLikeType {
-	template <typename Y> static auto test(Y *) -> decltype(std::declval<const Y &>().begin(), std::declval<const Y &>().end(), std::true_type());
-	template <typename> static auto test(...) -> std::false_type;
-public:
-	static inline constexpr bool value = decltype(test<std::remove_reference_t<std::remove_const_t<T>>>( nullptr ))::value;
-};
+// fixed shape: elements with a known width where every position has a known class (`\d{4}-\d{2}-\d{2}`)
+static constexpr size_t not_fixed_shape = static_cast<size_t>(-1);
 
-template <typename RE> struct regular_expression {
-	template <typename IteratorBegin, typename IteratorEnd> constexpr CTRE_FORCE_INLINE static auto match_2(IteratorBegin begin, IteratorEnd end) noexcept {
-		return match_re(begin, end, RE());
-	}
-	template <typename IteratorBegin, typename IteratorEnd> constexpr CTRE_FORCE_INLINE static auto search_2(IteratorBegin begin, IteratorEnd end) noexcept {
-		return search_re(begin, end, RE());
-	}
-	constexpr CTRE_FORCE_INLINE regular_expression() noexcept { }
-	constexpr CTRE_FORCE_INLINE regular_expression(RE) noexcept { }
-	template <typename Iterator> constexpr CTRE_FORCE_INLINE static auto match(Iterator begin, Iterator end) noexcept {
-		return match_re(begin, end, RE());
-	}
-	static constexpr CTRE_FORCE_INLINE auto match(const char * s) noexcept {
-		return match_2(s, zero_terminated_string_end_iterator());
-	}
-	static constexpr CTRE_FORCE_INLINE auto match(const wchar_t * s) noexcept {
-		return match_2(s, zero_terminated_string_end_iterator());
-	}
-	static constexpr CTRE_FORCE_INLINE auto match(const std::string & s) noexcept {
-		return match_2(s.c_str(), zero_terminated_string_end_iterator());
-	}
-	static constexpr CTRE_FORCE_INLINE auto match(const std::wstring & s) noexcept {
-		return match_2(s.c_str(), zero_terminated_string_end_iterator());
-	}
-	static constexpr CTRE_FORCE_INLINE auto match(std::string_view sv) noexcept {
-		return match(sv.begin(), sv.end());
-	}
-	static constexpr CTRE_FORCE_INLINE auto match(std::wstring_view sv) noexcept {
-		return match(sv.begin(), sv.end());
-	}
-	static constexpr CTRE_FORCE_INLINE auto match(std::u16string_view sv) noexcept {
-		return match(sv.begin(), sv.end());
-	}
-	static constexpr CTRE_FORCE_INLINE auto match(std::u32string_view sv) noexcept {
-		return match(sv.begin(), sv.end());
-	}
-	template <typename Range, typename = typename std::enable_if<RangeLikeType<Range>::value>::type> static constexpr CTRE_FORCE_INLINE auto match(Range && range) noexcept {
-		return match(std::begin(range), std::end(range));
-	}
-	template <typename Iterator> constexpr CTRE_FORCE_INLINE static auto search(Iterator begin, Iterator end) noexcept {
-		return search_re(begin, end, RE());
-	}
-	constexpr CTRE_FORCE_INLINE static auto search(const char * s) noexcept {
-		return search_2(s, zero_terminated_string_end_iterator());
+constexpr size_t fixed_shape_concat(size_t lhs, size_t rhs) noexcept {
+	return (lhs == not_fixed_shape || rhs == not_fixed_shape) ? not_fixed_shape : lhs + rhs;
+}
+
+template <typename CharacterLike> constexpr size_t fixed_shape_width(CharacterLike) noexcept {
+	if constexpr (MatchesCharacter<CharacterLike>::template value<char>) {
+		return 1;
+	} else {
+		return not_fixed_shape;
 	}
-	static constexpr CTRE_FORCE_INLINE auto search(const wchar_t * s) noexcept {
-		return search_2(s, zero_terminated_string_end_iterator());
+}
+
+template <auto... Str> constexpr size_t fixed_shape_width(string<Str...>) noexcept {
+	return sizeof...(Str);
+}
+
+constexpr size_t fixed_shape_width(empty) noexcept {
+	return 0;
+}
+
+template <typename... Content> constexpr size_t fixed_shape_width(sequence<Content...>) noexcept {
+	size_t out{0};
+	((out = fixed_shape_concat(out, fixed_shape_width(Content{}))), ...);
+	return out;
+}
+
+template <size_t Id, typename... Content> constexpr size_t fixed_shape_width(capture<Id, Content...>) noexcept {
+	return fixed_shape_width(sequence<Content...>{});
+}
+
+template <size_t Id, typename Name, typename... Content> constexpr size_t fixed_shape_width(capture_with_name<Id, Name, Content...>) noexcept {
+	return fixed_shape_width(sequence<Content...>{});
+}
+
+// only exact repeats without captures inside (a capture would be set by the last iteration)
+template <size_t A, typename... Content> constexpr size_t fixed_shape_repeat_width() noexcept {
+	const size_t width = fixed_shape_width(sequence<Content...>{});
+	if (A == 0 || width == not_fixed_shape || ctll::size(find_captures(sequence<Content...>{})) > 0) {
+		return not_fixed_shape;
 	}
-	static constexpr CTRE_FORCE_INLINE auto search(const std::string & s) noexcept {
-		return search_2(s.c_str(), zero_terminated_string_end_iterator());
+	return A * width;
+}
+
+template <size_t A, size_t B, typename... Content> constexpr size_t fixed_shape_width(repeat<A, B, Content...>) noexcept {
+	return (A == B) ? fixed_shape_repeat_width<A, Content...>() : not_fixed_shape;
+}
+
+template <size_t A, size_t B, typename... Content> constexpr size_t fixed_shape_width(lazy_repeat<A, B, Content...>) noexcept {
+	return (A == B) ? fixed_shape_repeat_width<A, Content...>() : not_fixed_shape;
+}
+
+template <size_t A, size_t B, typename... Content> constexpr size_t fixed_shape_width(possessive_repeat<A, B, Content...>) noexcept {
+	return (A == B) ? fixed_shape_repeat_width<A, Content...>() : not_fixed_shape;
+}
+
+// leading elements of a sequence which form a fixed shape
+template <typename Prefix, typename Rest> struct fixed_shape_split {
+	using prefix = Prefix;
+	using rest = Rest;
+};
+
+template <typename... Prefix> constexpr auto split_fixed_shape(ctll::list<Prefix...>, ctll::list<>) noexcept {
+	return fixed_shape_split<ctll::list<Prefix...>, ctll::list<>>{};
+}
+
+template <typename... Prefix, typename Head, typename... Rest> constexpr auto split_fixed_shape(ctll::list<Prefix...>, ctll::list<Head, Rest...>) noexcept {
+	if constexpr (fixed_shape_width(sequence<Prefix..., Head>{}) <= CTRE_FIXED_SHAPE_MAX_WIDTH) {
+		return split_fixed_shape(ctll::list<Prefix..., Head>{}, ctll::list<Rest...>{});
+	} else {
+		return fixed_shape_split<ctll::list<Prefix...>, ctll::list<Head, Rest...>>{};
 	}
-	static constexpr CTRE_FORCE_INLINE auto search(const std::wstring & s) noexcept {
-		return search_2(s.c_str(), zero_terminated_string_end_iterator());
+}
+
+template <typename T> static inline constexpr bool is_fixed_shape_string_v = false;
+template <auto... Str> static inline constexpr bool is_fixed_shape_string_v<string<Str...>> = true;
+
+// a lone string is already compared directly, and a few characters are faster without vectors
+template <typename... Prefix> constexpr bool worth_fixed_shape(ctll::list<Prefix...>) noexcept {
+	const size_t width = fixed_shape_width(sequence<Prefix...>{});
+	return width != not_fixed_shape && width >= 4 && (sizeof...(Prefix) > 1 || !(is_fixed_shape_string_v<Prefix> && ... && true));
+}
+
+// classes of each position and the same as ranges per 16 lanes (a range is a superset if the class isn't one range)
+template <size_t Width> struct fixed_shape {
+	static constexpr size_t width = Width;
+	static constexpr size_t chunks = (Width + 15) / 16;
+	// input needed to load every chunk
+	static constexpr size_t available = (Width < 16) ? 16 : Width;
+
+	uint64_t bits[Width][4];
+	bool lane_exact[Width];
+	bool exact;
+	// some lanes are a range only after `c | 0x20` (case insensitive letters)
+	bool folded;
+	unsigned char fold[chunks][16];
+	unsigned char low[chunks][16];
+	unsigned char span[chunks][16];
+
+	// last chunk overlaps the previous one instead of reading after the shape
+	static constexpr size_t chunk_offset(size_t chunk) noexcept {
+		return (Width <= 16) ? 0 : ((chunk * 16 + 16 <= Width) ? chunk * 16 : Width - 16);
 	}
-	static constexpr CTRE_FORCE_INLINE auto search(std::string_view sv) noexcept {
-		return search(sv.begin(), sv.end());
+	constexpr bool test(size_t lane, unsigned char c) const noexcept {
+		return (bits[lane][c >> 6] >> (c & 63u)) & 1u;
 	}
-	static constexpr CTRE_FORCE_INLINE auto search(std::wstring_view sv) noexcept {
-		return search(sv.begin(), sv.end());
+};
+
+template <typename CharT, typename Shape, typename CharacterLike> constexpr void fixed_shape_fill(Shape & shape, size_t & offset, CharacterLike) noexcept {
+	const byte_set set = make_byte_set<CharT>(ctll::list<CharacterLike>{});
+	for (size_t i = 0; i != 4; ++i) {
+		shape.bits[offset][i] = set.bits[i];
 	}
-	static constexpr CTRE_FORCE_INLINE auto search(std::u16string_view sv) noexcept {
-		return search(sv.begin(), sv.end());
+	++offset;
+}
+
+template <typename CharT, typename Shape, auto... Str> constexpr void fixed_shape_fill(Shape & shape, size_t & offset, string<Str...>) noexcept {
+	(fixed_shape_fill<CharT>(shape, offset, character<Str>{}), ...);
+}
+
+template <typename CharT, typename Shape> constexpr void fixed_shape_fill(Shape &, size_t &, empty) noexcept { }
+
+template <typename CharT, typename Shape, typename... Content> constexpr void fixed_shape_fill(Shape & shape, size_t & offset, sequence<Content...>) noexcept {
+	(fixed_shape_fill<CharT>(shape, offset, Content{}), ...);
+}
+
+template <typename CharT, typename Shape, size_t Id, typename... Content> constexpr void fixed_shape_fill(Shape & shape, size_t & offset, capture<Id, Content...>) noexcept {
+	(fixed_shape_fill<CharT>(shape, offset, Content{}), ...);
+}
+
+template <typename CharT, typename Shape, size_t Id, typename Name, typename... Content> constexpr void fixed_shape_fill(Shape & shape, size_t & offset, capture_with_name<Id, Name, Content...>) noexcept {
+	(fixed_shape_fill<CharT>(shape, offset, Content{}), ...);
+}
+
+template <typename CharT, typename Shape, size_t A, size_t B, typename... Content> constexpr void fixed_shape_fill(Shape & shape, size_t & offset, repeat<A, B, Content...>) noexcept {
+	for (size_t i = 0; i != A; ++i) (fixed_shape_fill<CharT>(shape, offset, Content{}), ...);
+}
+
+template <typename CharT, typename Shape, size_t A, size_t B, typename... Content> constexpr void fixed_shape_fill(Shape & shape, size_t & offset, lazy_repeat<A, B, Content...>) noexcept {
+	for (size_t i = 0; i != A; ++i) (fixed_shape_fill<CharT>(shape, offset, Content{}), ...);
+}
+
+template <typename CharT, typename Shape, size_t A, size_t B, typename... Content> constexpr void fixed_shape_fill(Shape & shape, size_t & offset, possessive_repeat<A, B, Content...>) noexcept {
+	for (size_t i = 0; i != A; ++i) (fixed_shape_fill<CharT>(shape, offset, Content{}), ...);
+}
+
+template <typename CharT, size_t Width, typename... Content> constexpr auto make_fixed_shape(ctll::list<Content...>) noexcept {
+	fixed_shape<Width> shape{};
+	size_t offset{0};
+	(fixed_shape_fill<CharT>(shape, offset, Content{}), ...);
+
+	// each lane as range [low, low+span] of `c | fold`
+	unsigned char fold[Width]{};
+	unsigned char low[Width]{};
+	unsigned char span[Width]{};
+	shape.exact = true;
+	shape.folded = false;
+	for (size_t lane = 0; lane != Width; ++lane) {
+		for (unsigned mask = 0; mask != 0x40; mask += 0x20) {
+			unsigned first{256};
+			unsigned last{0};
+			unsigned count{0};
+			bool same{true};
+			for (unsigned c = 0; c != 256; ++c) {
+				const bool inside = shape.test(lane, static_cast<unsigned char>(c));
+				// folding must not change the answer for any character
+				same = same && (inside == shape.test(lane, static_cast<unsigned char>(c | mask)));
+				if (inside && (c | mask) == c) {
+					if (first == 256) first = c;
+					last = c;
+					++count;
+				}
+			}
+			if (count == 0) {
+				// nothing matches, the table test rejects the lane
+				first = 0;
+				last = 0;
+			}
+			const bool lane_exact = same && (count == last - first + 1);
+			if (mask == 0 || lane_exact) {
+				fold[lane] = static_cast<unsigned char>(mask);
+				low[lane] = static_cast<unsigned char>(first);
+				span[lane] = static_cast<unsigned char>(last - first);
+				shape.lane_exact[lane] = lane_exact;
+			}
+			if (lane_exact) break;
+		}
+		shape.exact = shape.exact && shape.lane_exact[lane];
+		shape.folded = shape.folded || fold[lane] != 0;
+	}
+	for (size_t chunk = 0; chunk != fixed_shape<Width>::chunks; ++chunk) {
+		for (size_t i = 0; i != 16; ++i) {
+			const size_t lane = fixed_shape<Width>::chunk_offset(chunk) + i;
+			// lanes after the shape accept anything
+			shape.fold[chunk][i] = (lane < Width) ? fold[lane] : 0;
+			shape.low[chunk][i] = (lane < Width) ? low[lane] : 0;
+			shape.span[chunk][i] = (lane < Width) ? span[lane] : 255;
+		}
 	}
-	static constexpr CTRE_FORCE_INLINE auto search(std::u32string_view sv) noexcept {
-		return search(sv.begin(), sv.end());
+	return shape;
+}
+
+template <typename CharT, typename... Content> struct fixed_shape_of {
+	static constexpr size_t width = fixed_shape_width(sequence<Content...>{});
+	static constexpr fixed_shape<width> value = make_fixed_shape<CharT, width>(ctll::list<Content...>{});
+};
+
+#ifdef CTRE_SIMD_SSE2
+template <typename Iterator, typename EndIterator> static inline constexpr bool has_fixed_shape_matcher_v = is_byte_pointer_v<Iterator> && std::is_same_v<Iterator, EndIterator>;
+
+// all positions are checked as (c - low) <= span per lane, then classes which aren't a range with the table
+template <const auto & Shape> inline bool match_fixed_shape(const unsigned char * data) noexcept {
+	for (size_t chunk = 0; chunk != Shape.chunks; ++chunk) {
+		__m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + Shape.chunk_offset(chunk)));
+		if constexpr (Shape.folded) {
+			input = _mm_or_si128(input, _mm_loadu_si128(reinterpret_cast<const __m128i *>(Shape.fold[chunk])));
+		}
+		const __m128i shifted = _mm_sub_epi8(input, _mm_loadu_si128(reinterpret_cast<const __m128i *>(Shape.low[chunk])));
+		const __m128i inside = _mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_loadu_si128(reinterpret_cast<const __m128i *>(Shape.span[chunk]))), shifted);
+		if (_mm_movemask_epi8(inside) != 0xFFFF) return false;
 	}
-	template <typename Range> static constexpr CTRE_FORCE_INLINE auto search(Range && range) noexcept {
-		return search(std::begin(range), std::end(range));
+	if constexpr (!Shape.exact) {
+		for (size_t lane = 0; lane != Shape.width; ++lane) {
+			if (!Shape.lane_exact[lane] && !Shape.test(lane, data[lane])) return false;
+		}
 	}
-};
+	return true;
+}
+#else
+template <typename Iterator, typename EndIterator> static inline constexpr bool has_fixed_shape_matcher_v = false;
+#endif
 
-template <typename RE> regular_expression(RE) -> regular_expression<RE>;
+// captures inside a fixed shape are on known offsets
+template <size_t Offset, typename R, typename Iterator> constexpr CTRE_FORCE_INLINE void fixed_shape_captures(R &, Iterator, ctll::list<>) noexcept { }
+
+template <size_t Offset, typename R, typename Iterator, typename T> constexpr CTRE_FORCE_INLINE void fixed_shape_capture(R &, Iterator, T) noexcept { }
+
+template <size_t Offset, typename R, typename Iterator, typename... Content> constexpr CTRE_FORCE_INLINE void fixed_shape_capture(R & captures, Iterator current, sequence<Content...>) noexcept {
+	fixed_shape_captures<Offset>(captures, current, ctll::list<Content...>{});
+}
+
+template <size_t Offset, typename R, typename Iterator, size_t Id, typename... Content> constexpr CTRE_FORCE_INLINE void fixed_shape_capture(R & captures, Iterator current, capture<Id, Content...>) noexcept {
+	captures.template start_capture<Id>(current + Offset);
+	fixed_shape_captures<Offset>(captures, current, ctll::list<Content...>{});
+	captures.template end_capture<Id>(current + (Offset + fixed_shape_width(sequence<Content...>{})));
+}
+
+template <size_t Offset, typename R, typename Iterator, size_t Id, typename Name, typename... Content> constexpr CTRE_FORCE_INLINE void fixed_shape_capture(R & captures, Iterator current, capture_with_name<Id, Name, Content...>) noexcept {
+	captures.template start_capture<Id>(current + Offset);
+	fixed_shape_captures<Offset>(captures, current, ctll::list<Content...>{});
+	captures.template end_capture<Id>(current + (Offset + fixed_shape_width(sequence<Content...>{})));
+}
+
+template <size_t Offset, typename R, typename Iterator, typename Head, typename... Tail> constexpr CTRE_FORCE_INLINE void fixed_shape_captures(R & captures, Iterator current, ctll::list<Head, Tail...>) noexcept {
+	fixed_shape_capture<Offset>(captures, current, Head{});
+	fixed_shape_captures<Offset + fixed_shape_width(Head{})>(captures, current, ctll::list<Tail...>{});
+}
 
 }
 
 #endif
 
-#ifndef __EDG__
+#ifndef CTRE__LENGTH__HPP
+#define CTRE__LENGTH__HPP
+
+#include <limits>
 
 namespace ctre {
 
-// in C++17 (clang & gcc with gnu extension) we need translate character pack into ctll::fixed_string
-// in C++20 we have `class nontype template parameters`
+// minimal and maximal number of characters a match of the pattern consumes
+struct length_range {
+	static constexpr size_t infinite = std::numeric_limits<size_t>::max();
+	size_t min;
+	size_t max;
 
-#if !(__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
-template <typename CharT, CharT... input> static inline constexpr auto _fixed_string_reference = ctll::fixed_string< sizeof...(input)>({input...});
-#endif	
+	constexpr bool fixed() const noexcept {
+		return min == max;
+	}
+};
 
-namespace literals {
-	
-// clang and GCC <9 supports LITERALS with packs
+constexpr size_t saturated_add(size_t lhs, size_t rhs) noexcept {
+	return (lhs > length_range::infinite - rhs) ? length_range::infinite : lhs + rhs;
+}
 
-#ifdef __clang__
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wgnu-string-literal-operator-template"
-#define CTRE_ENABLE_LITERALS
-#endif
+constexpr size_t saturated_multiply(size_t lhs, size_t rhs) noexcept {
+	if (lhs == 0 || rhs == 0) return 0;
+	return (lhs > length_range::infinite / rhs) ? length_range::infinite : lhs * rhs;
+}
 
-#ifdef __INTEL_COMPILER
-// not enable literals
-#elif defined __GNUC__
-#if not(__GNUC__ == 9)
-#define CTRE_ENABLE_LITERALS
-#endif
-#endif
+constexpr length_range operator+(length_range lhs, length_range rhs) noexcept {
+	return {saturated_add(lhs.min, rhs.min), saturated_add(lhs.max, rhs.max)};
+}
 
-#ifdef CTRE_ENABLE_LITERALS
-	
-// add this when we will have concepts
-// requires ctll::parser<ctre::pcre, _fixed_string_reference<CharT, charpack...>, ctre::pcre_actions>::template correct_with<pcre_context<>>
+template <typename... Content> constexpr length_range sequence_length(ctll::list<Content...>) noexcept;
 
-#if !(__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
-template <typename CharT, CharT... charpack> CTRE_FLATTEN constexpr CTRE_FORCE_INLINE auto operator""_ctre() noexcept {
-	constexpr auto & _input = _fixed_string_reference<CharT, charpack...>;
-#else
-template <ctll::fixed_string input> CTRE_FLATTEN constexpr CTRE_FORCE_INLINE auto operator""_ctre() noexcept {
-	constexpr auto _input = input; // workaround for GCC 9 bug 88092
-#endif
-	using tmp = typename ctll::parser<ctre::pcre, _input, ctre::pcre_actions>::template output<pcre_context<>>;
-	static_assert(tmp(), "Regular Expression contains syntax error.");
-	if constexpr (tmp()) {
-		using re = decltype(front(typename tmp::output_type::stack_type()));
-		return ctre::regular_expression(re());
+// everything which behaves as a one character matcher
+template <typename CharacterLike> constexpr length_range pattern_length(CharacterLike) noexcept {
+	return {1, 1};
+}
+
+template <auto... Str> constexpr length_range pattern_length(string<Str...>) noexcept {
+	return {sizeof...(Str), sizeof...(Str)};
+}
+
+// zero width
+constexpr length_range pattern_length(empty) noexcept {
+	return {0, 0};
+}
+
+constexpr length_range pattern_length(assert_begin) noexcept {
+	return {0, 0};
+}
+
+constexpr length_range pattern_length(assert_end) noexcept {
+	return {0, 0};
+}
+
+constexpr length_range pattern_length(assert_line_begin) noexcept {
+	return {0, 0};
+}
+
+constexpr length_range pattern_length(assert_line_end) noexcept {
+	return {0, 0};
+}
+
+template <typename... Content> constexpr length_range pattern_length(lookahead_positive<Content...>) noexcept {
+	return {0, 0};
+}
+
+template <typename... Content> constexpr length_range pattern_length(lookahead_negative<Content...>) noexcept {
+	return {0, 0};
+}
+
+// back reference can be anything
+template <size_t Id> constexpr length_range pattern_length(back_reference<Id>) noexcept {
+	return {0, length_range::infinite};
+}
+
+template <typename Name> constexpr length_range pattern_length(back_reference_with_name<Name>) noexcept {
+	return {0, length_range::infinite};
+}
+
+// composition
+template <typename... Content> constexpr length_range pattern_length(sequence<Content...>) noexcept {
+	return sequence_length(ctll::list<Content...>{});
+}
+
+template <size_t Id, typename... Content> constexpr length_range pattern_length(capture<Id, Content...>) noexcept {
+	return sequence_length(ctll::list<Content...>{});
+}
+
+template <size_t Id, typename Name, typename... Content> constexpr length_range pattern_length(capture_with_name<Id, Name, Content...>) noexcept {
+	return sequence_length(ctll::list<Content...>{});
+}
+
+template <typename... Opts> constexpr length_range pattern_length(select<Opts...>) noexcept {
+	if constexpr (sizeof...(Opts) == 0) {
+		return {0, 0};
 	} else {
-		return ctre::regular_expression(reject());
+		const length_range options[] = {pattern_length(Opts{})...};
+		length_range out = options[0];
+		for (const auto & option: options) {
+			out.min = option.min < out.min ? option.min : out.min;
+			out.max = option.max > out.max ? option.max : out.max;
+		}
+		return out;
 	}
 }
 
-// this will need to be fixed with C++20
-#if !(__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
-template <typename CharT, CharT... charpack> CTRE_FLATTEN constexpr CTRE_FORCE_INLINE auto operator""_ctre_id() noexcept {
-	return id<charpack...>();
+template <typename... Content> constexpr length_range optional_length(ctll::list<Content...>) noexcept {
+	return {0, sequence_length(ctll::list<Content...>{}).max};
 }
-#endif
 
-#endif // CTRE_ENABLE_LITERALS
+template <typename... Content> constexpr length_range pattern_length(optional<Content...>) noexcept {
+	return optional_length(ctll::list<Content...>{});
+}
 
+template <typename... Content> constexpr length_range pattern_length(lazy_optional<Content...>) noexcept {
+	return optional_length(ctll::list<Content...>{});
 }
 
-namespace test_literals {
+// B == 0 means unbounded
+template <size_t A, size_t B, typename... Content> constexpr length_range repeat_length(ctll::list<Content...>) noexcept {
+	const length_range content = sequence_length(ctll::list<Content...>{});
+	const size_t max = (B == 0) ? (content.max == 0 ? 0 : length_range::infinite) : saturated_multiply(B, content.max);
+	return {saturated_multiply(A, content.min), max};
+}
+
+template <typename... Content> constexpr length_range pattern_length(plus<Content...>) noexcept {
+	return repeat_length<1, 0>(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr length_range pattern_length(lazy_plus<Content...>) noexcept {
+	return repeat_length<1, 0>(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr length_range pattern_length(possessive_plus<Content...>) noexcept {
+	return repeat_length<1, 0>(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr length_range pattern_length(star<Content...>) noexcept {
+	return repeat_length<0, 0>(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr length_range pattern_length(lazy_star<Content...>) noexcept {
+	return repeat_length<0, 0>(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr length_range pattern_length(possessive_star<Content...>) noexcept {
+	return repeat_length<0, 0>(ctll::list<Content...>{});
+}
+
+template <size_t A, size_t B, typename... Content> constexpr length_range pattern_length(repeat<A, B, Content...>) noexcept {
+	return repeat_length<A, B>(ctll::list<Content...>{});
+}
+
+template <size_t A, size_t B, typename... Content> constexpr length_range pattern_length(lazy_repeat<A, B, Content...>) noexcept {
+	return repeat_length<A, B>(ctll::list<Content...>{});
+}
+
+template <size_t A, size_t B, typename... Content> constexpr length_range pattern_length(possessive_repeat<A, B, Content...>) noexcept {
+	return repeat_length<A, B>(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr length_range sequence_length(ctll::list<Content...>) noexcept {
+	return (pattern_length(Content{}) + ... + length_range{0, 0});
+}
+
+// user facing interface
+template <typename... Content> constexpr length_range calculate_length(Content...) noexcept {
+	return sequence_length(ctll::list<Content...>{});
+}
+
+}
+
+#endif
+
+#ifndef CTRE__REQUIRED_FACTOR__HPP
+#define CTRE__REQUIRED_FACTOR__HPP
+
+#include <iterator>
+
+namespace ctre {
+
+// longest literal every match has to contain, with its distance from start of the match (if it's fixed)
+template <typename String, size_t Offset> struct required_factor {
+	using string = String;
+	static constexpr size_t offset = Offset; // length_range::infinite if it's not fixed
+};
+
+// the pattern is flattened into literal runs separated by gaps
+template <size_t Width> struct factor_gap { };
+struct factor_variable_gap { };
+
+template <typename... Out, typename Item> constexpr auto push_factor_item(ctll::list<Out...>, Item) noexcept {
+	return ctll::list<Out..., Item>{};
+}
+
+template <typename... Out, auto... Run> constexpr auto flush_factor_run(ctll::list<Out...> out, string<Run...>) noexcept {
+	if constexpr (sizeof...(Run) > 0) {
+		return ctll::list<Out..., string<Run...>>{};
+	} else {
+		return out;
+	}
+}
+
+// anything without a fixed width or inner structure is just a gap
+template <typename T> constexpr auto opaque_factor_item(T) noexcept {
+	constexpr length_range length = calculate_length(T{});
+	if constexpr (length.fixed()) {
+		return factor_gap<length.min>{};
+	} else {
+		return factor_variable_gap{};
+	}
+}
+
+template <typename... Out, auto... Run> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<>) noexcept {
+	return flush_factor_run(out, run);
+}
+
+template <typename... Out, auto... Run, typename Head, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<Head, Tail...>) noexcept {
+	return factor_items(out, run, ctll::list<decltype(opaque_factor_item(Head{})), Tail...>{});
+}
+
+template <typename... Out, auto... Run, size_t Width, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<factor_gap<Width>, Tail...>) noexcept {
+	return factor_items(push_factor_item(flush_factor_run(out, run), factor_gap<Width>{}), string<>{}, ctll::list<Tail...>{});
+}
+
+template <typename... Out, auto... Run, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<factor_variable_gap, Tail...>) noexcept {
+	return factor_items(push_factor_item(flush_factor_run(out, run), factor_variable_gap{}), string<>{}, ctll::list<Tail...>{});
+}
+
+// literals extend the current run
+template <typename... Out, auto... Run, auto V, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...>, ctll::list<character<V>, Tail...>) noexcept {
+	return factor_items(out, string<Run..., V>{}, ctll::list<Tail...>{});
+}
+
+template <typename... Out, auto... Run, auto... Str, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...>, ctll::list<string<Str...>, Tail...>) noexcept {
+	return factor_items(out, string<Run..., Str...>{}, ctll::list<Tail...>{});
+}
+
+// transparent nodes
+template <typename... Out, auto... Run, typename... Content, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<sequence<Content...>, Tail...>) noexcept {
+	return factor_items(out, run, ctll::list<Content..., Tail...>{});
+}
+
+template <typename... Out, auto... Run, size_t Id, typename... Content, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<capture<Id, Content...>, Tail...>) noexcept {
+	return factor_items(out, run, ctll::list<Content..., Tail...>{});
+}
+
+template <typename... Out, auto... Run, size_t Id, typename Name, typename... Content, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<capture_with_name<Id, Name, Content...>, Tail...>) noexcept {
+	return factor_items(out, run, ctll::list<Content..., Tail...>{});
+}
+
+template <typename... Out, auto... Run, typename Opt, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<select<Opt>, Tail...>) noexcept {
+	return factor_items(out, run, ctll::list<Opt, Tail...>{});
+}
+
+template <typename... Out, auto... Run, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<empty, Tail...>) noexcept {
+	return factor_items(out, run, ctll::list<Tail...>{});
+}
+
+template <typename... Out, auto... Run, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<assert_begin, Tail...>) noexcept {
+	return factor_items(out, run, ctll::list<Tail...>{});
+}
+
+template <typename... Out, auto... Run, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<assert_end, Tail...>) noexcept {
+	return factor_items(out, run, ctll::list<Tail...>{});
+}
+
+template <typename... Out, auto... Run, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<assert_line_begin, Tail...>) noexcept {
+	return factor_items(out, run, ctll::list<Tail...>{});
+}
+
+template <typename... Out, auto... Run, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<assert_line_end, Tail...>) noexcept {
+	return factor_items(out, run, ctll::list<Tail...>{});
+}
+
+// the first iteration is mandatory, the rest is a gap
+template <size_t A, size_t B, typename... Out, auto... Run, typename... Content, typename... Tail> constexpr auto repeat_factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<Content...>, ctll::list<Tail...>) noexcept {
+	constexpr length_range length = calculate_length(Content{}...);
+	if constexpr (A == 0) {
+		return factor_items(out, run, ctll::list<decltype(opaque_factor_item(repeat<A, B, Content...>{})), Tail...>{});
+	} else if constexpr (A == B && length.fixed()) {
+		return factor_items(out, run, ctll::list<Content..., factor_gap<(A - 1) * length.min>, Tail...>{});
+	} else {
+		return factor_items(out, run, ctll::list<Content..., factor_variable_gap, Tail...>{});
+	}
+}
+
+template <typename... Out, auto... Run, typename... Content, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<plus<Content...>, Tail...>) noexcept {
+	return repeat_factor_items<1, 0>(out, run, ctll::list<Content...>{}, ctll::list<Tail...>{});
+}
+
+template <typename... Out, auto... Run, typename... Content, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<lazy_plus<Content...>, Tail...>) noexcept {
+	return repeat_factor_items<1, 0>(out, run, ctll::list<Content...>{}, ctll::list<Tail...>{});
+}
+
+template <typename... Out, auto... Run, typename... Content, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<possessive_plus<Content...>, Tail...>) noexcept {
+	return repeat_factor_items<1, 0>(out, run, ctll::list<Content...>{}, ctll::list<Tail...>{});
+}
+
+template <typename... Out, auto... Run, size_t A, size_t B, typename... Content, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<repeat<A, B, Content...>, Tail...>) noexcept {
+	return repeat_factor_items<A, B>(out, run, ctll::list<Content...>{}, ctll::list<Tail...>{});
+}
+
+template <typename... Out, auto... Run, size_t A, size_t B, typename... Content, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<lazy_repeat<A, B, Content...>, Tail...>) noexcept {
+	return repeat_factor_items<A, B>(out, run, ctll::list<Content...>{}, ctll::list<Tail...>{});
+}
+
+template <typename... Out, auto... Run, size_t A, size_t B, typename... Content, typename... Tail> constexpr auto factor_items(ctll::list<Out...> out, string<Run...> run, ctll::list<possessive_repeat<A, B, Content...>, Tail...>) noexcept {
+	return repeat_factor_items<A, B>(out, run, ctll::list<Content...>{}, ctll::list<Tail...>{});
+}
+
+// pick the longest run (the first one of the same length)
+template <typename Best, size_t BestOffset, size_t Offset> constexpr auto pick_required_factor(ctll::list<>) noexcept {
+	return required_factor<Best, BestOffset>{};
+}
+
+template <typename Best, size_t BestOffset, size_t Offset, auto... Str, typename... Tail> constexpr auto pick_required_factor(ctll::list<string<Str...>, Tail...>) noexcept {
+	constexpr size_t next = (Offset == length_range::infinite) ? Offset : Offset + sizeof...(Str);
+	if constexpr (sizeof...(Str) > string_length(Best{})) {
+		return pick_required_factor<string<Str...>, Offset, next>(ctll::list<Tail...>{});
+	} else {
+		return pick_required_factor<Best, BestOffset, next>(ctll::list<Tail...>{});
+	}
+}
+
+template <typename Best, size_t BestOffset, size_t Offset, size_t Width, typename... Tail> constexpr auto pick_required_factor(ctll::list<factor_gap<Width>, Tail...>) noexcept {
+	return pick_required_factor<Best, BestOffset, saturated_add(Offset, Width)>(ctll::list<Tail...>{});
+}
+
+template <typename Best, size_t BestOffset, size_t Offset, typename... Tail> constexpr auto pick_required_factor(ctll::list<factor_variable_gap, Tail...>) noexcept {
+	return pick_required_factor<Best, BestOffset, length_range::infinite>(ctll::list<Tail...>{});
+}
+
+// user facing interface
+template <typename... Content> constexpr auto calculate_required_factor(Content...) noexcept {
+	return pick_required_factor<string<>, 0, 0>(factor_items(ctll::list<>{}, string<>{}, ctll::list<Content...>{}));
+}
+
+// locating the factor in the subject
+
+template <typename Iterator, typename = void> struct is_random_access_iterator: std::false_type { };
+
+template <typename Iterator> struct is_random_access_iterator<Iterator, std::void_t<typename std::iterator_traits<Iterator>::iterator_category>>: std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category> { };
+
+template <typename Iterator> static inline constexpr bool is_random_access_iterator_v = is_random_access_iterator<Iterator>::value;
+
+template <typename Iterator, typename = void> struct is_bidirectional_iterator: std::false_type { };
+
+template <typename Iterator> struct is_bidirectional_iterator<Iterator, std::void_t<typename std::iterator_traits<Iterator>::iterator_category>>: std::is_base_of<std::bidirectional_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category> { };
+
+template <typename Iterator> static inline constexpr bool is_bidirectional_iterator_v = is_bidirectional_iterator<Iterator>::value;
+
+// Boyer-Moore-Horspool shifts indexed by the lowest byte of a character (so it works for wider characters too)
+struct horspool_shifts {
+	unsigned char shift[256]{};
+};
+
+template <auto... Factor> constexpr horspool_shifts make_horspool_shifts() noexcept {
+	constexpr size_t length = sizeof...(Factor);
+	constexpr unsigned char bytes[] = {static_cast<unsigned char>(Factor)...};
+	horspool_shifts out;
+	for (auto & shift: out.shift) {
+		shift = static_cast<unsigned char>(length < 255 ? length : 255);
+	}
+	for (size_t i = 0; i + 1 < length; ++i) {
+		const size_t distance = length - 1 - i;
+		out.shift[bytes[i]] = static_cast<unsigned char>(distance < 255 ? distance : 255);
+	}
+	return out;
+}
+
+template <auto... Factor> struct horspool_table {
+	static constexpr horspool_shifts value = make_horspool_shifts<Factor...>();
+};
+
+// move `current` to the next occurrence of the factor, returns false if there is none
+template <auto Head, auto... Tail, typename Iterator>
+constexpr CTRE_FORCE_INLINE bool find_required_factor(Iterator & current, const Iterator end, string<Head, Tail...> factor) noexcept {
+	constexpr size_t length = 1 + sizeof...(Tail);
+	if constexpr (length < 4) {
+		// too short to skip much, memchr is faster
+		return find_leading_string(current, end, factor);
+	} else {
+		using difference_type = decltype(end - current);
+		for (; end - current >= static_cast<difference_type>(length); current += horspool_table<Head, Tail...>::value.shift[static_cast<unsigned char>(*(current + (length - 1)))]) {
+			if (starts_with_string<Head, Tail...>(current, end)) {
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+// a match starting at some position must contain the factor at or after it
+template <typename Factor, typename Iterator> struct required_factor_filter {
+	Iterator occurrence;
+	bool found;
+
+	constexpr CTRE_FORCE_INLINE required_factor_filter(Iterator begin, const Iterator end) noexcept: occurrence{begin}, found{find_required_factor(occurrence, end, typename Factor::string{})} { }
+
+	constexpr CTRE_FORCE_INLINE bool allows(Iterator position, const Iterator end) noexcept {
+		if (found && occurrence < position) {
+			occurrence = position;
+			found = find_required_factor(occurrence, end, typename Factor::string{});
+		}
+		return found;
+	}
+};
+
+struct no_required_factor_filter {
+	template <typename Iterator, typename EndIterator> constexpr CTRE_FORCE_INLINE bool allows(Iterator, EndIterator) const noexcept {
+		return true;
+	}
+};
+
+// factor is only usable with random access subjects and only if it's better than the literal prefix
+template <typename Factor, typename Prefix, typename Iterator, typename EndIterator> static inline constexpr bool use_required_factor_v = std::is_same_v<Iterator, EndIterator> && is_random_access_iterator_v<Iterator> && (string_length(typename Factor::string{}) > string_length(Prefix{}));
+
+template <typename Factor, typename Prefix, typename Iterator, typename EndIterator> constexpr auto make_required_factor_filter(Iterator begin, const EndIterator end) noexcept {
+	if constexpr (use_required_factor_v<Factor, Prefix, Iterator, EndIterator>) {
+		return required_factor_filter<Factor, Iterator>(begin, end);
+	} else {
+		return no_required_factor_filter{};
+	}
+}
+
+}
+
+#endif
+
+#ifndef CTRE__REACH__HPP
+#define CTRE__REACH__HPP
+
+namespace ctre {
+
+// what else than the matched characters a match depends on
+struct match_reach {
+	bool search_begin{false}; // `^` depends on where the subject begins (a restarted search has to be told, see search_2(begin, from, end))
+	bool subject_end{false}; // `$` and lookaheads see characters (or the end) behind the match
+	bool newline{false}; // a match can contain '\n'
+	bool preceding{false}; // multiline `^` reads the character before the match
+	
+	constexpr match_reach operator|(match_reach rhs) const noexcept {
+		return {search_begin || rhs.search_begin, subject_end || rhs.subject_end, newline || rhs.newline, preceding || rhs.preceding};
+	}
+};
+
+template <typename... Content> constexpr match_reach sequence_reach(ctll::list<Content...>) noexcept;
+
+template <typename CharacterLike> constexpr match_reach pattern_reach(CharacterLike) noexcept {
+	if constexpr (MatchesCharacter<CharacterLike>::template value<char>) {
+		return {false, false, CharacterLike::match_char('\n')};
+	} else {
+		return {};
+	}
+}
+
+template <auto... Str> constexpr match_reach pattern_reach(string<Str...>) noexcept {
+	return {false, false, ((Str == '\n') || ... || false)};
+}
+
+constexpr match_reach pattern_reach(assert_begin) noexcept {
+	return {true, false, false};
+}
+
+constexpr match_reach pattern_reach(assert_end) noexcept {
+	return {false, true, false};
+}
+
+// the character before the match
+constexpr match_reach pattern_reach(assert_line_begin) noexcept {
+	return {true, false, false, true};
+}
+
+constexpr match_reach pattern_reach(assert_line_end) noexcept {
+	return {false, true, false};
+}
+
+template <typename... Content> constexpr match_reach pattern_reach(lookahead_positive<Content...>) noexcept {
+	return {false, true, false};
+}
+
+template <typename... Content> constexpr match_reach pattern_reach(lookahead_negative<Content...>) noexcept {
+	return {false, true, false};
+}
+
+// back reference repeats what its capture matched
+template <size_t Id> constexpr match_reach pattern_reach(back_reference<Id>) noexcept {
+	return {};
+}
+
+template <typename Name> constexpr match_reach pattern_reach(back_reference_with_name<Name>) noexcept {
+	return {};
+}
+
+template <typename... Content> constexpr match_reach pattern_reach(sequence<Content...>) noexcept {
+	return sequence_reach(ctll::list<Content...>{});
+}
+
+template <typename... Opts> constexpr match_reach pattern_reach(select<Opts...>) noexcept {
+	return sequence_reach(ctll::list<Opts...>{});
+}
+
+template <size_t Id, typename... Content> constexpr match_reach pattern_reach(capture<Id, Content...>) noexcept {
+	return sequence_reach(ctll::list<Content...>{});
+}
+
+template <size_t Id, typename Name, typename... Content> constexpr match_reach pattern_reach(capture_with_name<Id, Name, Content...>) noexcept {
+	return sequence_reach(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr match_reach pattern_reach(optional<Content...>) noexcept {
+	return sequence_reach(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr match_reach pattern_reach(lazy_optional<Content...>) noexcept {
+	return sequence_reach(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr match_reach pattern_reach(plus<Content...>) noexcept {
+	return sequence_reach(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr match_reach pattern_reach(lazy_plus<Content...>) noexcept {
+	return sequence_reach(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr match_reach pattern_reach(possessive_plus<Content...>) noexcept {
+	return sequence_reach(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr match_reach pattern_reach(star<Content...>) noexcept {
+	return sequence_reach(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr match_reach pattern_reach(lazy_star<Content...>) noexcept {
+	return sequence_reach(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr match_reach pattern_reach(possessive_star<Content...>) noexcept {
+	return sequence_reach(ctll::list<Content...>{});
+}
+
+template <size_t A, size_t B, typename... Content> constexpr match_reach pattern_reach(repeat<A, B, Content...>) noexcept {
+	return sequence_reach(ctll::list<Content...>{});
+}
+
+template <size_t A, size_t B, typename... Content> constexpr match_reach pattern_reach(lazy_repeat<A, B, Content...>) noexcept {
+	return sequence_reach(ctll::list<Content...>{});
+}
+
+template <size_t A, size_t B, typename... Content> constexpr match_reach pattern_reach(possessive_repeat<A, B, Content...>) noexcept {
+	return sequence_reach(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr match_reach sequence_reach(ctll::list<Content...>) noexcept {
+	return (pattern_reach(Content{}) | ... | match_reach{});
+}
+
+}
+
+#endif
+
+#ifndef CTRE__GLUSHKOV__HPP
+#define CTRE__GLUSHKOV__HPP
+
+#include <cstdint>
+
+namespace ctre {
+
+// position automaton (Glushkov) of the regular subset of patterns:
+// every character matcher is a position, transitions go between positions
+
+constexpr unsigned lowest_bit_index(uint64_t word) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+	return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+	unsigned out{0};
+	for (; !(word & 1u); word >>= 1) ++out;
+	return out;
+#endif
+}
+
+template <size_t Words> struct position_set {
+	uint64_t bits[Words]{};
+
+	constexpr void insert(size_t i) noexcept {
+		bits[i / 64] |= uint64_t(1) << (i % 64);
+	}
+	constexpr void erase(size_t i) noexcept {
+		bits[i / 64] &= ~(uint64_t(1) << (i % 64));
+	}
+	constexpr bool test(size_t i) const noexcept {
+		return (bits[i / 64] >> (i % 64)) & 1u;
+	}
+	constexpr bool empty() const noexcept {
+		for (size_t i = 0; i < Words; ++i) {
+			if (bits[i]) return false;
+		}
+		return true;
+	}
+	constexpr bool intersects(const position_set & rhs) const noexcept {
+		for (size_t i = 0; i < Words; ++i) {
+			if (bits[i] & rhs.bits[i]) return true;
+		}
+		return false;
+	}
+	constexpr position_set & operator|=(const position_set & rhs) noexcept {
+		for (size_t i = 0; i < Words; ++i) {
+			bits[i] |= rhs.bits[i];
+		}
+		return *this;
+	}
+	constexpr position_set operator|(const position_set & rhs) const noexcept {
+		position_set out = *this;
+		return out |= rhs;
+	}
+	constexpr position_set operator&(const position_set & rhs) const noexcept {
+		position_set out;
+		for (size_t i = 0; i < Words; ++i) {
+			out.bits[i] = bits[i] & rhs.bits[i];
+		}
+		return out;
+	}
+	constexpr bool operator==(const position_set & rhs) const noexcept {
+		for (size_t i = 0; i < Words; ++i) {
+			if (bits[i] != rhs.bits[i]) return false;
+		}
+		return true;
+	}
+	constexpr bool operator!=(const position_set & rhs) const noexcept {
+		return !(*this == rhs);
+	}
+	constexpr size_t count() const noexcept {
+		size_t out{0};
+		for (size_t i = 0; i < Words; ++i) {
+			for (uint64_t word = bits[i]; word; word &= word - 1) ++out;
+		}
+		return out;
+	}
+	template <typename Fn> constexpr void for_each(Fn && fn) const noexcept {
+		for (size_t i = 0; i < Words; ++i) {
+			for (uint64_t word = bits[i]; word; word &= word - 1) {
+				fn(i * 64 + lowest_bit_index(word));
+			}
+		}
+	}
+};
+
+// patterns with plain regular semantics (no back references, lookarounds or possessive repeats, asserts only if allowed)
+template <bool Asserts, typename CharacterLike> constexpr bool regular_compatible(CharacterLike) noexcept {
+	return MatchesCharacter<CharacterLike>::template value<char>;
+}
+
+template <bool Asserts, typename... Content> constexpr bool regular_compatible_sequence(ctll::list<Content...>) noexcept {
+	return (regular_compatible<Asserts>(Content{}) && ... && true);
+}
+
+template <bool Asserts, auto... Str> constexpr bool regular_compatible(string<Str...>) noexcept {
+	return true;
+}
+
+template <bool Asserts> constexpr bool regular_compatible(empty) noexcept {
+	return true;
+}
+
+template <bool Asserts, typename... Content> constexpr bool regular_compatible(sequence<Content...>) noexcept {
+	return regular_compatible_sequence<Asserts>(ctll::list<Content...>{});
+}
+
+template <bool Asserts, typename... Opts> constexpr bool regular_compatible(select<Opts...>) noexcept {
+	return regular_compatible_sequence<Asserts>(ctll::list<Opts...>{});
+}
+
+template <bool Asserts, size_t Id, typename... Content> constexpr bool regular_compatible(capture<Id, Content...>) noexcept {
+	return regular_compatible_sequence<Asserts>(ctll::list<Content...>{});
+}
+
+template <bool Asserts, size_t Id, typename Name, typename... Content> constexpr bool regular_compatible(capture_with_name<Id, Name, Content...>) noexcept {
+	return regular_compatible_sequence<Asserts>(ctll::list<Content...>{});
+}
+
+template <bool Asserts, typename... Content> constexpr bool regular_compatible(optional<Content...>) noexcept {
+	return regular_compatible_sequence<Asserts>(ctll::list<Content...>{});
+}
+
+template <bool Asserts, typename... Content> constexpr bool regular_compatible(lazy_optional<Content...>) noexcept {
+	return regular_compatible_sequence<Asserts>(ctll::list<Content...>{});
+}
+
+template <bool Asserts, typename... Content> constexpr bool regular_compatible(plus<Content...>) noexcept {
+	return regular_compatible_sequence<Asserts>(ctll::list<Content...>{});
+}
+
+template <bool Asserts, typename... Content> constexpr bool regular_compatible(lazy_plus<Content...>) noexcept {
+	return regular_compatible_sequence<Asserts>(ctll::list<Content...>{});
+}
+
+template <bool Asserts, typename... Content> constexpr bool regular_compatible(star<Content...>) noexcept {
+	return regular_compatible_sequence<Asserts>(ctll::list<Content...>{});
+}
+
+template <bool Asserts, typename... Content> constexpr bool regular_compatible(lazy_star<Content...>) noexcept {
+	return regular_compatible_sequence<Asserts>(ctll::list<Content...>{});
+}
+
+template <bool Asserts, size_t A, size_t B, typename... Content> constexpr bool regular_compatible(repeat<A, B, Content...>) noexcept {
+	return regular_compatible_sequence<Asserts>(ctll::list<Content...>{});
+}
+
+template <bool Asserts, size_t A, size_t B, typename... Content> constexpr bool regular_compatible(lazy_repeat<A, B, Content...>) noexcept {
+	return regular_compatible_sequence<Asserts>(ctll::list<Content...>{});
+}
+
+template <bool Asserts, typename... Content> constexpr bool regular_compatible(possessive_plus<Content...>) noexcept {
+	return false;
+}
+
+template <bool Asserts, typename... Content> constexpr bool regular_compatible(possessive_star<Content...>) noexcept {
+	return false;
+}
+
+template <bool Asserts, size_t A, size_t B, typename... Content> constexpr bool regular_compatible(possessive_repeat<A, B, Content...>) noexcept {
+	return false;
+}
+
+template <bool Asserts, size_t Id> constexpr bool regular_compatible(back_reference<Id>) noexcept {
+	return false;
+}
+
+template <bool Asserts, typename Name> constexpr bool regular_compatible(back_reference_with_name<Name>) noexcept {
+	return false;
+}
+
+template <bool Asserts, typename... Content> constexpr bool regular_compatible(lookahead_positive<Content...>) noexcept {
+	return false;
+}
+
+template <bool Asserts, typename... Content> constexpr bool regular_compatible(lookahead_negative<Content...>) noexcept {
+	return false;
+}
+
+template <bool Asserts> constexpr bool regular_compatible(assert_begin) noexcept {
+	return Asserts;
+}
+
+template <bool Asserts> constexpr bool regular_compatible(assert_end) noexcept {
+	return Asserts;
+}
+
+// line anchors depend on the neighbouring characters
+template <bool Asserts> constexpr bool regular_compatible(assert_line_begin) noexcept {
+	return false;
+}
+
+template <bool Asserts> constexpr bool regular_compatible(assert_line_end) noexcept {
+	return false;
+}
+
+// leading `^` and trailing `$` of the whole pattern are handled by the engines themselves
+template <typename Pattern, bool Begin, bool End> struct anchored_pattern {
+	using type = Pattern;
+	static constexpr bool begin = Begin;
+	static constexpr bool end = End;
+};
+
+template <typename... Content> constexpr auto strip_trailing_anchor(ctll::list<Content...>, ctll::list<>) noexcept {
+	return anchored_pattern<sequence<Content...>, false, false>{};
+}
+
+template <typename... Content> constexpr auto strip_trailing_anchor(ctll::list<Content...>, ctll::list<assert_end>) noexcept {
+	return anchored_pattern<sequence<Content...>, false, true>{};
+}
+
+template <typename... Content, typename Head, typename... Tail> constexpr auto strip_trailing_anchor(ctll::list<Content...>, ctll::list<Head, Tail...>) noexcept {
+	return strip_trailing_anchor(ctll::list<Content..., Head>{}, ctll::list<Tail...>{});
+}
+
+template <typename Pattern> constexpr auto strip_anchors(Pattern) noexcept {
+	return anchored_pattern<Pattern, false, false>{};
+}
+
+template <typename... Content> constexpr auto strip_anchors(sequence<Content...>) noexcept {
+	return strip_trailing_anchor(ctll::list<>{}, ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr auto strip_anchors(sequence<assert_begin, Content...>) noexcept {
+	using rest = decltype(strip_trailing_anchor(ctll::list<>{}, ctll::list<Content...>{}));
+	return anchored_pattern<typename rest::type, true, rest::end>{};
+}
+
+// number of positions
+template <typename CharacterLike> constexpr size_t glushkov_positions(CharacterLike) noexcept {
+	return 1;
+}
+
+template <typename... Content> constexpr size_t glushkov_positions_sequence(ctll::list<Content...>) noexcept {
+	return (glushkov_positions(Content{}) + ... + 0);
+}
+
+template <auto... Str> constexpr size_t glushkov_positions(string<Str...>) noexcept {
+	return sizeof...(Str);
+}
+
+constexpr size_t glushkov_positions(empty) noexcept {
+	return 0;
+}
+
+template <typename... Content> constexpr size_t glushkov_positions(sequence<Content...>) noexcept {
+	return glushkov_positions_sequence(ctll::list<Content...>{});
+}
+
+template <typename... Opts> constexpr size_t glushkov_positions(select<Opts...>) noexcept {
+	return glushkov_positions_sequence(ctll::list<Opts...>{});
+}
+
+template <size_t Id, typename... Content> constexpr size_t glushkov_positions(capture<Id, Content...>) noexcept {
+	return glushkov_positions_sequence(ctll::list<Content...>{});
+}
+
+template <size_t Id, typename Name, typename... Content> constexpr size_t glushkov_positions(capture_with_name<Id, Name, Content...>) noexcept {
+	return glushkov_positions_sequence(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr size_t glushkov_positions(optional<Content...>) noexcept {
+	return glushkov_positions_sequence(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr size_t glushkov_positions(lazy_optional<Content...>) noexcept {
+	return glushkov_positions_sequence(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr size_t glushkov_positions(plus<Content...>) noexcept {
+	return glushkov_positions_sequence(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr size_t glushkov_positions(lazy_plus<Content...>) noexcept {
+	return glushkov_positions_sequence(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr size_t glushkov_positions(star<Content...>) noexcept {
+	return glushkov_positions_sequence(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr size_t glushkov_positions(lazy_star<Content...>) noexcept {
+	return glushkov_positions_sequence(ctll::list<Content...>{});
+}
+
+// counted repeats are unrolled: x{A,B} => A copies and B-A optional copies, x{A,} => A-1 copies and x+
+template <size_t A, size_t B> constexpr size_t glushkov_copies() noexcept {
+	if constexpr (B == 0) {
+		return A > 1 ? A : 1;
+	} else {
+		return B;
+	}
+}
+
+template <size_t A, size_t B, typename... Content> constexpr size_t glushkov_positions(repeat<A, B, Content...>) noexcept {
+	return saturated_multiply(glushkov_copies<A, B>(), glushkov_positions_sequence(ctll::list<Content...>{}));
+}
+
+template <size_t A, size_t B, typename... Content> constexpr size_t glushkov_positions(lazy_repeat<A, B, Content...>) noexcept {
+	return saturated_multiply(glushkov_copies<A, B>(), glushkov_positions_sequence(ctll::list<Content...>{}));
+}
+
+// the automaton itself, two extra positions are starts (looping one for searching and non-looping one)
+template <size_t Positions> struct glushkov_nfa {
+	static constexpr size_t positions = Positions;
+	static constexpr size_t size = Positions + 2;
+	static constexpr size_t words = (size + 63) / 64;
+	static constexpr size_t start_loop = Positions;
+	static constexpr size_t start_once = Positions + 1;
+	using set_type = position_set<words>;
+
+	byte_set symbols[size]{};
+	set_type follow[size]{};
+	set_type first{};
+	set_type last{};
+	bool nullable{false};
+	// positions with accepting state (last positions, and starts if the pattern is nullable)
+	set_type accepting{};
+	size_t used{0};
+};
+
+template <typename Set> struct glushkov_fragment {
+	Set first{};
+	Set last{};
+	bool nullable{true};
+};
+
+template <size_t N> constexpr auto glushkov_concat(glushkov_nfa<N> & nfa, const glushkov_fragment<typename glushkov_nfa<N>::set_type> & lhs, const glushkov_fragment<typename glushkov_nfa<N>::set_type> & rhs) noexcept {
+	for (size_t p = 0; p < N; ++p) {
+		if (lhs.last.test(p)) nfa.follow[p] |= rhs.first;
+	}
+	glushkov_fragment<typename glushkov_nfa<N>::set_type> out;
+	out.first = lhs.nullable ? (lhs.first | rhs.first) : lhs.first;
+	out.last = rhs.nullable ? (lhs.last | rhs.last) : rhs.last;
+	out.nullable = lhs.nullable && rhs.nullable;
+	return out;
+}
+
+template <size_t N> constexpr auto glushkov_loop(glushkov_nfa<N> & nfa, glushkov_fragment<typename glushkov_nfa<N>::set_type> fragment) noexcept {
+	for (size_t p = 0; p < N; ++p) {
+		if (fragment.last.test(p)) nfa.follow[p] |= fragment.first;
+	}
+	return fragment;
+}
+
+template <typename CharT, size_t N, typename... Content> constexpr auto glushkov_sequence(glushkov_nfa<N> & nfa, ctll::list<Content...>) noexcept;
+
+template <typename CharT, size_t N, typename CharacterLike> constexpr auto glushkov(glushkov_nfa<N> & nfa, CharacterLike) noexcept {
+	const size_t p = nfa.used++;
+	nfa.symbols[p] = make_byte_set<CharT>(ctll::list<CharacterLike>{});
+	glushkov_fragment<typename glushkov_nfa<N>::set_type> out;
+	out.first.insert(p);
+	out.last.insert(p);
+	out.nullable = false;
+	return out;
+}
+
+template <typename CharT, size_t N, auto... Str> constexpr auto glushkov(glushkov_nfa<N> & nfa, string<Str...>) noexcept {
+	return glushkov_sequence<CharT>(nfa, ctll::list<character<Str>...>{});
+}
+
+template <typename CharT, size_t N> constexpr auto glushkov(glushkov_nfa<N> &, empty) noexcept {
+	return glushkov_fragment<typename glushkov_nfa<N>::set_type>{};
+}
+
+template <typename CharT, size_t N, typename... Content> constexpr auto glushkov(glushkov_nfa<N> & nfa, sequence<Content...>) noexcept {
+	return glushkov_sequence<CharT>(nfa, ctll::list<Content...>{});
+}
+
+template <typename CharT, size_t N, size_t Id, typename... Content> constexpr auto glushkov(glushkov_nfa<N> & nfa, capture<Id, Content...>) noexcept {
+	return glushkov_sequence<CharT>(nfa, ctll::list<Content...>{});
+}
+
+template <typename CharT, size_t N, size_t Id, typename Name, typename... Content> constexpr auto glushkov(glushkov_nfa<N> & nfa, capture_with_name<Id, Name, Content...>) noexcept {
+	return glushkov_sequence<CharT>(nfa, ctll::list<Content...>{});
+}
+
+template <typename CharT, size_t N, typename... Opts> constexpr auto glushkov(glushkov_nfa<N> & nfa, select<Opts...>) noexcept {
+	glushkov_fragment<typename glushkov_nfa<N>::set_type> out;
+	out.nullable = false;
+	const auto add = [&](const auto & option) {
+		out.first |= option.first;
+		out.last |= option.last;
+		out.nullable = out.nullable || option.nullable;
+	};
+	(add(glushkov<CharT>(nfa, Opts{})), ...);
+	return out;
+}
+
+template <typename CharT, size_t A, size_t B, size_t N, typename... Content> constexpr auto glushkov_repeat(glushkov_nfa<N> & nfa, ctll::list<Content...> content) noexcept {
+	glushkov_fragment<typename glushkov_nfa<N>::set_type> out;
+	if constexpr (B == 0) {
+		for (size_t i = 1; i < A; ++i) {
+			out = glushkov_concat(nfa, out, glushkov_sequence<CharT>(nfa, content));
+		}
+		auto tail = glushkov_loop(nfa, glushkov_sequence<CharT>(nfa, content));
+		tail.nullable = tail.nullable || (A == 0);
+		out = glushkov_concat(nfa, out, tail);
+	} else {
+		for (size_t i = 0; i < B; ++i) {
+			auto copy = glushkov_sequence<CharT>(nfa, content);
+			copy.nullable = copy.nullable || (i >= A);
+			out = glushkov_concat(nfa, out, copy);
+		}
+	}
+	return out;
+}
+
+template <typename CharT, size_t N, typename... Content> constexpr auto glushkov(glushkov_nfa<N> & nfa, optional<Content...>) noexcept {
+	return glushkov_repeat<CharT, 0, 1>(nfa, ctll::list<Content...>{});
+}
+
+template <typename CharT, size_t N, typename... Content> constexpr auto glushkov(glushkov_nfa<N> & nfa, lazy_optional<Content...>) noexcept {
+	return glushkov_repeat<CharT, 0, 1>(nfa, ctll::list<Content...>{});
+}
+
+template <typename CharT, size_t N, typename... Content> constexpr auto glushkov(glushkov_nfa<N> & nfa, plus<Content...>) noexcept {
+	return glushkov_repeat<CharT, 1, 0>(nfa, ctll::list<Content...>{});
+}
+
+template <typename CharT, size_t N, typename... Content> constexpr auto glushkov(glushkov_nfa<N> & nfa, lazy_plus<Content...>) noexcept {
+	return glushkov_repeat<CharT, 1, 0>(nfa, ctll::list<Content...>{});
+}
+
+template <typename CharT, size_t N, typename... Content> constexpr auto glushkov(glushkov_nfa<N> & nfa, star<Content...>) noexcept {
+	return glushkov_repeat<CharT, 0, 0>(nfa, ctll::list<Content...>{});
+}
+
+template <typename CharT, size_t N, typename... Content> constexpr auto glushkov(glushkov_nfa<N> & nfa, lazy_star<Content...>) noexcept {
+	return glushkov_repeat<CharT, 0, 0>(nfa, ctll::list<Content...>{});
+}
+
+template <typename CharT, size_t N, size_t A, size_t B, typename... Content> constexpr auto glushkov(glushkov_nfa<N> & nfa, repeat<A, B, Content...>) noexcept {
+	return glushkov_repeat<CharT, A, B>(nfa, ctll::list<Content...>{});
+}
+
+template <typename CharT, size_t N, size_t A, size_t B, typename... Content> constexpr auto glushkov(glushkov_nfa<N> & nfa, lazy_repeat<A, B, Content...>) noexcept {
+	return glushkov_repeat<CharT, A, B>(nfa, ctll::list<Content...>{});
+}
+
+template <typename CharT, size_t N, typename... Content> constexpr auto glushkov_sequence(glushkov_nfa<N> & nfa, ctll::list<Content...>) noexcept {
+	glushkov_fragment<typename glushkov_nfa<N>::set_type> out;
+	((out = glushkov_concat(nfa, out, glushkov<CharT>(nfa, Content{}))), ...);
+	return out;
+}
+
+// user facing interface (pattern must be compatible and without anchors)
+template <typename CharT, typename Pattern> constexpr auto build_glushkov(Pattern) noexcept {
+	constexpr size_t positions = glushkov_positions(Pattern{});
+	glushkov_nfa<positions> nfa;
+	const auto top = glushkov<CharT>(nfa, Pattern{});
+	nfa.first = top.first;
+	nfa.last = top.last;
+	nfa.nullable = top.nullable;
+
+	nfa.symbols[nfa.start_loop] = byte_set{}.complement();
+	nfa.follow[nfa.start_loop] = top.first;
+	nfa.follow[nfa.start_loop].insert(nfa.start_loop);
+	nfa.follow[nfa.start_once] = top.first;
+
+	nfa.accepting = top.last;
+	if (top.nullable) {
+		nfa.accepting.insert(nfa.start_loop);
+		nfa.accepting.insert(nfa.start_once);
+	}
+	return nfa;
+}
+
+// same language read from the end
+template <size_t N> constexpr auto reverse_glushkov(const glushkov_nfa<N> & nfa) noexcept {
+	glushkov_nfa<N> out;
+	out.used = nfa.used;
+	out.nullable = nfa.nullable;
+	out.first = nfa.last;
+	out.last = nfa.first;
+	for (size_t p = 0; p < N; ++p) {
+		out.symbols[p] = nfa.symbols[p];
+		for (size_t q = 0; q < N; ++q) {
+			if (nfa.follow[p].test(q)) out.follow[q].insert(p);
+		}
+	}
+	out.symbols[out.start_loop] = nfa.symbols[nfa.start_loop];
+	out.follow[out.start_loop] = out.first;
+	out.follow[out.start_loop].insert(out.start_loop);
+	out.follow[out.start_once] = out.first;
+
+	out.accepting = out.last;
+	if (out.nullable) {
+		out.accepting.insert(out.start_loop);
+		out.accepting.insert(out.start_once);
+	}
+	return out;
+}
+
+}
+
+#endif
+
+#ifndef CTRE__DFA__HPP
+#define CTRE__DFA__HPP
+
+#include <cstdint>
+#include <type_traits>
+
+// limits for building DFA at compile-time
+#ifndef CTRE_DFA_MAX_POSITIONS
+#define CTRE_DFA_MAX_POSITIONS 128
+#endif
+#ifndef CTRE_DFA_MAX_STATES
+#define CTRE_DFA_MAX_STATES 256
+#endif
+
+namespace ctre {
+
+// subsets of Glushkov positions as states, bytes with the same transitions everywhere are grouped into classes
+
+struct dfa_byte_classes {
+	unsigned char of[256]{};
+	size_t count{1};
+};
+
+template <typename NFA> constexpr dfa_byte_classes make_dfa_byte_classes(const NFA & nfa) noexcept {
+	dfa_byte_classes out;
+	for (size_t p = 0; p < NFA::positions; ++p) {
+		// split every class by membership in symbols of the position
+		size_t inside[256]{};
+		size_t outside[256]{};
+		size_t count{0};
+		for (unsigned c = 0; c < 256; ++c) {
+			size_t & slot = nfa.symbols[p].test(static_cast<unsigned char>(c)) ? inside[out.of[c]] : outside[out.of[c]];
+			if (slot == 0) slot = ++count;
+			out.of[c] = static_cast<unsigned char>(slot - 1);
+		}
+		out.count = count;
+	}
+	return out;
+}
+
+template <typename NFA, size_t Classes, size_t MaxStates> struct dfa_builder {
+	using set_type = typename NFA::set_type;
+
+	set_type sets[MaxStates]{};
+	size_t next[MaxStates][Classes]{};
+	// same state without the looping start (search stops starting new matches)
+	size_t strip[MaxStates]{};
+	bool accepting[MaxStates]{};
+	// cheap check before comparing whole sets
+	uint64_t hashes[MaxStates]{};
+	size_t states{0};
+	bool overflow{false};
+
+	static constexpr uint64_t hash(const set_type & set) noexcept {
+		uint64_t out{0};
+		for (uint64_t word: set.bits) {
+			out = (out ^ word) * 0x9E3779B97F4A7C15ull;
+		}
+		return out;
+	}
+
+	constexpr size_t find_or_add(const set_type & set) noexcept {
+		const uint64_t h = hash(set);
+		for (size_t i = 0; i < states; ++i) {
+			if (hashes[i] == h && sets[i] == set) return i;
+		}
+		if (states == MaxStates) {
+			overflow = true;
+			return 0;
+		}
+		sets[states] = set;
+		hashes[states] = h;
+		return states++;
+	}
+};
+
+// positions accepting given class
+template <typename Set, size_t Classes> struct dfa_class_masks {
+	Set of[Classes]{};
+};
+
+template <size_t Classes, typename NFA> constexpr auto make_dfa_class_masks(const NFA & nfa, const dfa_byte_classes & classes) noexcept {
+	dfa_class_masks<typename NFA::set_type, Classes> out;
+	for (unsigned c = 0; c < 256; ++c) {
+		for (size_t p = 0; p < NFA::size; ++p) {
+			if (nfa.symbols[p].test(static_cast<unsigned char>(c))) out.of[classes.of[c]].insert(p);
+		}
+	}
+	return out;
+}
+
+template <size_t Classes, size_t MaxStates, typename NFA> constexpr auto build_dfa(const NFA & nfa, const dfa_byte_classes & classes) noexcept {
+	using set_type = typename NFA::set_type;
+	dfa_builder<NFA, Classes, MaxStates> out;
+
+	const auto masks = make_dfa_class_masks<Classes>(nfa, classes);
+
+	set_type start_loop{};
+	start_loop.insert(NFA::start_loop);
+	set_type start_once{};
+	start_once.insert(NFA::start_once);
+
+	out.find_or_add(set_type{}); // 0 = dead state
+	out.find_or_add(start_loop); // 1
+	out.find_or_add(start_once); // 2
+
+	for (size_t i = 0; i < out.states && !out.overflow; ++i) {
+		set_type reachable{};
+		for (size_t p = 0; p < NFA::size; ++p) {
+			if (out.sets[i].test(p)) reachable |= nfa.follow[p];
+		}
+		for (size_t k = 0; k < Classes; ++k) {
+			out.next[i][k] = out.find_or_add(reachable & masks.of[k]);
+		}
+		set_type stripped = out.sets[i];
+		stripped.erase(NFA::start_loop);
+		out.strip[i] = out.find_or_add(stripped);
+		out.accepting[i] = out.sets[i].intersects(nfa.accepting);
+	}
+	return out;
+}
+
+// the final table, states are stored as offsets of their rows and ordered as (dead, rejecting..., accepting...)
+template <size_t States, size_t Classes> struct dfa_table {
+	using index_type = std::conditional_t<(States * Classes <= 0xFFFFu), uint16_t, uint32_t>;
+
+	unsigned char classes[256]{};
+	index_type next[States * Classes]{};
+	index_type strip[States]{};
+	index_type start_loop{0};
+	index_type start_once{0};
+	index_type first_accepting{0};
+
+	template <typename CharT> constexpr CTRE_FORCE_INLINE index_type step(index_type state, CharT c) const noexcept {
+		return next[state + classes[static_cast<unsigned char>(c)]];
+	}
+	constexpr CTRE_FORCE_INLINE bool accepting(index_type state) const noexcept {
+		return state >= first_accepting;
+	}
+	constexpr CTRE_FORCE_INLINE index_type stripped(index_type state) const noexcept {
+		return strip[state / Classes];
+	}
+	constexpr CTRE_FORCE_INLINE index_type start(bool loop) const noexcept {
+		return loop ? start_loop : start_once;
+	}
+	constexpr CTRE_FORCE_INLINE bool dead(index_type state) const noexcept {
+		return state == 0;
+	}
+};
+
+// row of every state of the builder in the final table
+template <size_t States> struct dfa_state_order {
+	size_t of[States]{};
+	size_t first_accepting{0};
+};
+
+template <size_t States, typename Builder> constexpr auto make_dfa_state_order(const Builder & builder) noexcept {
+	dfa_state_order<States> out;
+	size_t count{0};
+	for (size_t i = 0; i < States; ++i) {
+		if (!builder.accepting[i]) out.of[i] = count++;
+	}
+	out.first_accepting = count;
+	for (size_t i = 0; i < States; ++i) {
+		if (builder.accepting[i]) out.of[i] = count++;
+	}
+	return out;
+}
+
+template <size_t States, size_t Classes, typename Builder> constexpr auto compact_dfa(const Builder & builder, const dfa_byte_classes & classes) noexcept {
+	dfa_table<States, Classes> out;
+	using index_type = typename dfa_table<States, Classes>::index_type;
+
+	const auto state_order = make_dfa_state_order<States>(builder);
+	const auto & order = state_order.of;
+	const size_t first_accepting = state_order.first_accepting;
+
+	for (size_t i = 0; i < States; ++i) {
+		for (size_t k = 0; k < Classes; ++k) {
+			out.next[order[i] * Classes + k] = static_cast<index_type>(order[builder.next[i][k]] * Classes);
+		}
+		out.strip[order[i]] = static_cast<index_type>(order[builder.strip[i]] * Classes);
+	}
+	for (unsigned c = 0; c < 256; ++c) {
+		out.classes[c] = classes.of[c];
+	}
+	out.start_loop = static_cast<index_type>(order[1] * Classes);
+	out.start_once = static_cast<index_type>(order[2] * Classes);
+	out.first_accepting = static_cast<index_type>(first_accepting * Classes);
+	return out;
+}
+
+template <bool Fits, size_t States, size_t Classes, typename Builder> constexpr auto make_dfa_table(const Builder & builder, const dfa_byte_classes & classes) noexcept {
+	if constexpr (Fits) {
+		return compact_dfa<States, Classes>(builder, classes);
+	} else {
+		return dfa_table<1, 1>{};
+	}
+}
+
+template <typename CharT, typename Pattern, bool Reverse = false> struct dfa_automaton {
+	static constexpr auto nfa = Reverse ? reverse_glushkov(build_glushkov<CharT>(Pattern{})) : build_glushkov<CharT>(Pattern{});
+	static constexpr auto classes = make_dfa_byte_classes(nfa);
+	static constexpr auto builder = build_dfa<classes.count, CTRE_DFA_MAX_STATES>(nfa, classes);
+	static constexpr bool fits = !builder.overflow;
+	static constexpr auto table = make_dfa_table<fits, builder.states, classes.count>(builder, classes);
+};
+
+// conditions
+
+template <typename CharT> static inline constexpr bool is_dfa_character_v = (sizeof(CharT) == 1) && std::is_integral_v<CharT>;
+
+template <typename Pattern> constexpr bool dfa_compatible(Pattern) noexcept {
+	using anchored = decltype(strip_anchors(Pattern{}));
+	return regular_compatible<false>(typename anchored::type{}) && glushkov_positions(typename anchored::type{}) <= CTRE_DFA_MAX_POSITIONS;
+}
+
+template <typename Iterator> using dfa_character_t = std::remove_cv_t<std::remove_reference_t<decltype(*std::declval<Iterator>())>>;
+
+template <typename Iterator, typename Pattern> constexpr bool dfa_usable() noexcept {
+	if constexpr (is_dfa_character_v<dfa_character_t<Iterator>> && dfa_compatible(Pattern{})) {
+		return dfa_automaton<dfa_character_t<Iterator>, typename decltype(strip_anchors(Pattern{}))::type>::fits;
+	} else {
+		return false;
+	}
+}
+
+// matching with any automaton providing start(loop), step(state, c), accepting(state), stripped(state) and dead(state)
+
+// whole subject (anchors are implicit)
+template <typename Automaton, typename Iterator, typename EndIterator> 
+constexpr inline auto automaton_match(Automaton & automaton, const Iterator begin, const EndIterator end) noexcept {
+	regex_results<Iterator> out{};
+	auto state = automaton.start(false);
+	Iterator current = begin;
+	for (; end != current; ++current) {
+		state = automaton.step(state, *current);
+		if (automaton.dead(state)) return out;
+	}
+	if (!automaton.accepting(state)) return out;
+	return out.set_start_mark(begin).set_end_mark(current).matched();
+}
+
+// leftmost-longest match (leftmost start first, then the longest match from it)
+template <bool AnchorBegin, bool AnchorEnd, typename Automaton, typename ReverseAutomaton, typename Iterator, typename EndIterator> 
+constexpr inline auto automaton_search(Automaton & automaton, [[maybe_unused]] ReverseAutomaton & reverse_automaton, const Iterator begin, const EndIterator end) noexcept {
+	const auto accepts = [&](const auto & state, const Iterator & position) {
+		return automaton.accepting(state) && (!AnchorEnd || end == position);
+	};
+
+	regex_results<Iterator> out{};
+	Iterator start = begin;
+
+	if constexpr (!AnchorBegin) {
+		// 1) forward: first end of any match, then continue without starting new ones to get the furthest end
+		auto state = automaton.start(true);
+		Iterator current = begin;
+		while (!accepts(state, current)) {
+			if (end == current) return out;
+			state = automaton.step(state, *current);
+			++current;
+		}
+		Iterator last = current;
+		state = automaton.stripped(state);
+		while (end != current) {
+			state = automaton.step(state, *current);
+			++current;
+			if (automaton.dead(state)) break;
+			if (accepts(state, current)) last = current;
+		}
+
+		// 2) backward: leftmost start of a match ending before `last`
+		auto reverse_state = reverse_automaton.start(!AnchorEnd);
+		start = last;
+		Iterator position = last;
+		while (begin != position) {
+			--position;
+			reverse_state = reverse_automaton.step(reverse_state, *position);
+			if (reverse_automaton.dead(reverse_state)) break;
+			if (reverse_automaton.accepting(reverse_state)) start = position;
+		}
+	}
+
+	// 3) forward: longest match from the start
+	auto state = automaton.start(false);
+	Iterator current = start;
+	bool found = accepts(state, current);
+	Iterator match_end = current;
+	while (end != current) {
+		state = automaton.step(state, *current);
+		++current;
+		if (automaton.dead(state)) break;
+		if (accepts(state, current)) {
+			found = true;
+			match_end = current;
+		}
+	}
+	if (!found) return out;
+	return out.set_start_mark(start).set_end_mark(match_end).matched();
+}
+
+template <typename Iterator, typename EndIterator, typename Pattern> 
+constexpr inline auto dfa_match_re(const Iterator begin, const EndIterator end, Pattern) noexcept {
+	static_assert(dfa_usable<Iterator, Pattern>(), "DFA engine needs 1-byte characters and a regular pattern (no back references, lookarounds, possessive repeats, or anchors inside) which fits into its limits.");
+	using automaton = dfa_automaton<dfa_character_t<Iterator>, typename decltype(strip_anchors(Pattern{}))::type>;
+	return automaton_match(automaton::table, begin, end);
+}
+
+template <typename Iterator, typename EndIterator, typename Pattern> 
+constexpr inline auto dfa_search_re(const Iterator begin, const EndIterator end, Pattern) noexcept {
+	static_assert(dfa_usable<Iterator, Pattern>(), "DFA engine needs 1-byte characters and a regular pattern (no back references, lookarounds, possessive repeats, or anchors inside) which fits into its limits.");
+	using anchored = decltype(strip_anchors(Pattern{}));
+	using automaton = dfa_automaton<dfa_character_t<Iterator>, typename anchored::type>;
+	if constexpr (anchored::begin) {
+		return automaton_search<true, anchored::end>(automaton::table, automaton::table, begin, end);
+	} else {
+		using backward = dfa_automaton<dfa_character_t<Iterator>, typename anchored::type, true>;
+		return automaton_search<false, anchored::end>(automaton::table, backward::table, begin, end);
+	}
+}
+
+// the backtracking engine gives the same result as the DFA (and it's worth to use the DFA)
+
+// with a choice inside repeat the backtracking doesn't revisit previous iterations
+template <typename CharacterLike> constexpr bool choice_free(CharacterLike) noexcept {
+	return MatchesCharacter<CharacterLike>::template value<char>;
+}
+
+template <typename... Content> constexpr bool choice_free_sequence(ctll::list<Content...>) noexcept {
+	return (choice_free(Content{}) && ... && true);
+}
+
+template <auto... Str> constexpr bool choice_free(string<Str...>) noexcept {
+	return true;
+}
+
+constexpr bool choice_free(empty) noexcept {
+	return true;
+}
+
+template <typename... Content> constexpr bool choice_free(sequence<Content...>) noexcept {
+	return choice_free_sequence(ctll::list<Content...>{});
+}
+
+template <size_t Id, typename... Content> constexpr bool choice_free(capture<Id, Content...>) noexcept {
+	return choice_free_sequence(ctll::list<Content...>{});
+}
+
+template <size_t Id, typename Name, typename... Content> constexpr bool choice_free(capture_with_name<Id, Name, Content...>) noexcept {
+	return choice_free_sequence(ctll::list<Content...>{});
+}
+
+template <typename... Opts> constexpr bool choice_free(select<Opts...>) noexcept {
+	return false;
+}
+
+template <typename... Content> constexpr bool choice_free(optional<Content...>) noexcept {
+	return false;
+}
+
+template <typename... Content> constexpr bool choice_free(lazy_optional<Content...>) noexcept {
+	return false;
+}
+
+// number of repeats without upper bound (where the backtracking can be slow), or -1 if the result would differ
+template <typename CharacterLike> constexpr int backtracking_cost(CharacterLike) noexcept {
+	return 0;
+}
+
+template <typename... Content> constexpr int backtracking_cost_sequence(ctll::list<Content...>) noexcept {
+	int out{0};
+	const int costs[] = {0, backtracking_cost(Content{})...};
+	for (int cost: costs) {
+		if (cost < 0) return -1;
+		out += cost;
+	}
+	return out;
+}
+
+template <typename... Content> constexpr int backtracking_cost(sequence<Content...>) noexcept {
+	return backtracking_cost_sequence(ctll::list<Content...>{});
+}
+
+template <typename... Opts> constexpr int backtracking_cost(select<Opts...>) noexcept {
+	return backtracking_cost_sequence(ctll::list<Opts...>{});
+}
+
+template <size_t Id, typename... Content> constexpr int backtracking_cost(capture<Id, Content...>) noexcept {
+	return backtracking_cost_sequence(ctll::list<Content...>{});
+}
+
+template <size_t Id, typename Name, typename... Content> constexpr int backtracking_cost(capture_with_name<Id, Name, Content...>) noexcept {
+	return backtracking_cost_sequence(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr int backtracking_cost(optional<Content...>) noexcept {
+	return backtracking_cost_sequence(ctll::list<Content...>{});
+}
+
+template <typename... Content> constexpr int backtracking_cost(lazy_optional<Content...>) noexcept {
+	return backtracking_cost_sequence(ctll::list<Content...>{});
+}
+
+template <size_t A, size_t B, typename... Content> constexpr int backtracking_repeat_cost() noexcept {
+	if (!choice_free_sequence(ctll::list<Content...>{})) return -1;
+	return B == 0 ? 1 : 0;
+}
+
+template <typename... Content> constexpr int backtracking_cost(plus<Content...>) noexcept {
+	return backtracking_repeat_cost<1, 0, Content...>();
+}
+
+template <typename... Content> constexpr int backtracking_cost(lazy_plus<Content...>) noexcept {
+	return backtracking_repeat_cost<1, 0, Content...>();
+}
+
+template <typename... Content> constexpr int backtracking_cost(star<Content...>) noexcept {
+	return backtracking_repeat_cost<0, 0, Content...>();
+}
+
+template <typename... Content> constexpr int backtracking_cost(lazy_star<Content...>) noexcept {
+	return backtracking_repeat_cost<0, 0, Content...>();
+}
+
+template <size_t A, size_t B, typename... Content> constexpr int backtracking_cost(repeat<A, B, Content...>) noexcept {
+	return backtracking_repeat_cost<A, B, Content...>();
+}
+
+template <size_t A, size_t B, typename... Content> constexpr int backtracking_cost(lazy_repeat<A, B, Content...>) noexcept {
+	return backtracking_repeat_cost<A, B, Content...>();
+}
+
+// match without captures of a pattern with at least two unbounded repeats (polynomial backtracking) uses the DFA
+template <typename Iterator, typename Pattern> constexpr bool dfa_preferred() noexcept {
+#ifdef CTRE_DISABLE_AUTO_DFA
+	return false;
+#else
+	if constexpr (!is_dfa_character_v<dfa_character_t<Iterator>> || (ctll::size(find_captures(Pattern{})) > 0)) {
+		return false;
+	} else if constexpr (!dfa_compatible(Pattern{}) || backtracking_cost(typename decltype(strip_anchors(Pattern{}))::type{}) < 2) {
+		return false;
+	} else {
+		return dfa_usable<Iterator, Pattern>();
+	}
+#endif
+}
+
+}
+
+#endif
+
+#ifndef CTRE__LAZY_DFA__HPP
+#define CTRE__LAZY_DFA__HPP
+
+#include <cstdint>
+#include <vector>
+
+// limits of the hybrid engine: positions of the compile-time NFA and bytes of the per-thread cache of DFA states (for every automaton)
+#ifndef CTRE_LAZY_DFA_MAX_POSITIONS
+#define CTRE_LAZY_DFA_MAX_POSITIONS 512
+#endif
+#ifndef CTRE_LAZY_DFA_CACHE_SIZE
+#define CTRE_LAZY_DFA_CACHE_SIZE (1u << 20)
+#endif
+// after so many cache flushes in one search with only few characters per created state the search continues without the cache
+#ifndef CTRE_LAZY_DFA_MAX_FLUSHES
+#define CTRE_LAZY_DFA_MAX_FLUSHES 4
+#endif
+
+namespace ctre {
+
+// DFA states are built at run time from the compile-time NFA, only those really visited
+
+template <typename CharT, typename Pattern, bool Reverse = false> struct lazy_dfa_automaton {
+	static constexpr auto nfa = Reverse ? reverse_glushkov(build_glushkov<CharT>(Pattern{})) : build_glushkov<CharT>(Pattern{});
+	using nfa_type = std::remove_cv_t<decltype(nfa)>;
+	using set_type = typename nfa_type::set_type;
+	static constexpr auto classes = make_dfa_byte_classes(nfa);
+	static constexpr auto masks = make_dfa_class_masks<classes.count>(nfa, classes);
+	
+	static constexpr set_type start(bool loop) noexcept {
+		set_type out{};
+		out.insert(loop ? nfa_type::start_loop : nfa_type::start_once);
+		return out;
+	}
+	static constexpr set_type next(const set_type & from, size_t cls) noexcept {
+		set_type reachable{};
+		from.for_each([&](size_t p) {
+			reachable |= nfa.follow[p];
+		});
+		return reachable & masks.of[cls];
+	}
+	static constexpr set_type stripped(set_type from) noexcept {
+		from.erase(nfa_type::start_loop);
+		return from;
+	}
+	static constexpr bool accepting(const set_type & set) noexcept {
+		return set.intersects(nfa.accepting);
+	}
+};
+
+// NFA simulation over sets of positions (in constant evaluation, and when the cache thrashes)
+template <typename Automaton> struct lazy_dfa_simulation {
+	using state_type = typename Automaton::set_type;
+	
+	constexpr state_type start(bool loop) const noexcept {
+		return Automaton::start(loop);
+	}
+	template <typename CharT> constexpr state_type step(const state_type & state, CharT c) const noexcept {
+		return Automaton::next(state, Automaton::classes.of[static_cast<unsigned char>(c)]);
+	}
+	constexpr bool accepting(const state_type & state) const noexcept {
+		return Automaton::accepting(state);
+	}
+	constexpr state_type stripped(const state_type & state) const noexcept {
+		return Automaton::stripped(state);
+	}
+	constexpr bool dead(const state_type & state) const noexcept {
+		return state.empty();
+	}
+};
+
+// bounded cache of DFA states, it's flushed when it's full
+// a state is the offset of its row of transitions, the highest bit marks accepting states
+template <typename Automaton> class lazy_dfa_cache {
+public:
+	using set_type = typename Automaton::set_type;
+	static constexpr size_t classes = Automaton::classes.count;
+	static constexpr uint32_t accepting_flag = uint32_t{1} << 31;
+	static constexpr uint32_t unknown = ~uint32_t{0};
+	static constexpr size_t state_bytes = classes * sizeof(uint32_t) + sizeof(set_type) + 3 * sizeof(uint32_t);
+	static constexpr size_t max_states = (CTRE_LAZY_DFA_CACHE_SIZE / state_bytes > 16) ? (CTRE_LAZY_DFA_CACHE_SIZE / state_bytes) : 16;
+	
+	static constexpr size_t slot_count() noexcept {
+		size_t out{1};
+		while (out < 2 * max_states) out *= 2;
+		return out;
+	}
+	
+	std::vector<uint32_t> next;
+	std::vector<set_type> sets;
+	std::vector<uint32_t> strip;
+	size_t flushes{0};
+	
+private:
+	// open addressing, slot keeps state + 1
+	std::vector<uint32_t> slots;
+	
+	static uint64_t hash(const set_type & set) noexcept {
+		uint64_t out{0};
+		for (uint64_t word: set.bits) {
+			out = (out ^ word) * 0x9E3779B97F4A7C15ull;
+		}
+		return out ^ (out >> 29);
+	}
+	
+public:
+	lazy_dfa_cache(): slots(slot_count(), 0) {
+		clear();
+	}
+	
+	void clear() noexcept {
+		next.clear();
+		sets.clear();
+		strip.clear();
+		std::fill(slots.begin(), slots.end(), uint32_t{0});
+		find_or_add(set_type{}); // 0 = dead state
+	}
+	void flush() noexcept {
+		clear();
+		++flushes;
+	}
+	
+	// state of the set, or unknown when the cache is full
+	uint32_t find_or_add(const set_type & set) noexcept {
+		const size_t mask = slots.size() - 1;
+		for (size_t i = static_cast<size_t>(hash(set)) & mask;; i = (i + 1) & mask) {
+			if (slots[i] == 0) {
+				if (sets.size() == max_states) return unknown;
+				const size_t index = sets.size();
+				sets.push_back(set);
+				strip.push_back(unknown);
+				next.insert(next.end(), classes, unknown);
+				slots[i] = static_cast<uint32_t>(index + 1);
+				return static_cast<uint32_t>(index * classes) | (Automaton::accepting(set) ? accepting_flag : 0);
+			}
+			const size_t index = slots[i] - 1;
+			if (sets[index] == set) {
+				return static_cast<uint32_t>(index * classes) | (Automaton::accepting(set) ? accepting_flag : 0);
+			}
+		}
+	}
+	const set_type & set_of(uint32_t state) const noexcept {
+		return sets[(state & ~accepting_flag) / classes];
+	}
+};
+
+template <typename Automaton> inline lazy_dfa_cache<Automaton> & lazy_dfa_thread_cache() noexcept {
+	thread_local lazy_dfa_cache<Automaton> cache;
+	return cache;
+}
+
+// one search over the cache, it gives up (and moves into dead state) when the cache thrashes
+template <typename Automaton> class lazy_dfa_run {
+	using cache_type = lazy_dfa_cache<Automaton>;
+	cache_type & cache;
+	size_t steps{0};
+	size_t steps_at_flush{0};
+	size_t flushes{0};
+	bool thrashing{false};
+	
+	uint32_t add(const typename cache_type::set_type & set) noexcept {
+		if (thrashing) return 0;
+		if (const uint32_t state = cache.find_or_add(set); state != cache_type::unknown) {
+			return state;
+		}
+		// too little work done between flushes => caching doesn't help
+		if (++flushes > CTRE_LAZY_DFA_MAX_FLUSHES && (steps - steps_at_flush) < 8 * cache_type::max_states) {
+			thrashing = true;
+			return 0;
+		}
+		cache.flush();
+		steps_at_flush = steps;
+		return cache.find_or_add(set);
+	}
+	
+	CTRE_FORCE_INLINE uint32_t slow_step(uint32_t state, size_t cls) noexcept {
+		const auto target = Automaton::next(cache.set_of(state), cls);
+		const size_t flushes_before = cache.flushes;
+		const uint32_t out = add(target);
+		// remember the transition only if the source survived
+		if (cache.flushes == flushes_before && !thrashing) {
+			cache.next[(state & ~cache_type::accepting_flag) + cls] = out;
+		}
+		return out;
+	}
+	
+public:
+	explicit lazy_dfa_run(cache_type & c) noexcept: cache{c} { }
+	
+	bool gave_up() const noexcept {
+		return thrashing;
+	}
+	uint32_t start(bool loop) noexcept {
+		return add(Automaton::start(loop));
+	}
+	template <typename CharT> CTRE_FORCE_INLINE uint32_t step(uint32_t state, CharT c) noexcept {
+		++steps;
+		const size_t cls = Automaton::classes.of[static_cast<unsigned char>(c)];
+		const uint32_t out = cache.next[(state & ~cache_type::accepting_flag) + cls];
+		if (out != cache_type::unknown) return out;
+		return slow_step(state, cls);
+	}
+	CTRE_FORCE_INLINE bool accepting(uint32_t state) const noexcept {
+		return state & cache_type::accepting_flag;
+	}
+	CTRE_FORCE_INLINE bool dead(uint32_t state) const noexcept {
+		return state == 0;
+	}
+	uint32_t stripped(uint32_t state) noexcept {
+		const size_t index = (state & ~cache_type::accepting_flag) / cache_type::classes;
+		if (cache.strip[index] != cache_type::unknown) return cache.strip[index];
+		const size_t flushes_before = cache.flushes;
+		const uint32_t out = add(Automaton::stripped(cache.sets[index]));
+		if (cache.flushes == flushes_before && !thrashing) {
+			cache.strip[index] = out;
+		}
+		return out;
+	}
+};
+
+// conditions
+
+template <typename Pattern> constexpr bool lazy_dfa_compatible(Pattern) noexcept {
+	using anchored = decltype(strip_anchors(Pattern{}));
+	return regular_compatible<false>(typename anchored::type{}) && glushkov_positions(typename anchored::type{}) <= CTRE_LAZY_DFA_MAX_POSITIONS;
+}
+
+template <typename Iterator, typename Pattern> constexpr bool lazy_dfa_usable() noexcept {
+	return is_dfa_character_v<dfa_character_t<Iterator>> && lazy_dfa_compatible(Pattern{});
+}
+
+template <typename Iterator, typename EndIterator, typename Pattern> 
+inline auto lazy_dfa_match_runtime(const Iterator begin, const EndIterator end, Pattern, bool & gave_up) noexcept {
+	using automaton = lazy_dfa_automaton<dfa_character_t<Iterator>, typename decltype(strip_anchors(Pattern{}))::type>;
+	lazy_dfa_run<automaton> run{lazy_dfa_thread_cache<automaton>()};
+	const auto out = automaton_match(run, begin, end);
+	gave_up = run.gave_up();
+	return out;
+}
+
+template <typename Iterator, typename EndIterator, typename Pattern> 
+inline auto lazy_dfa_search_runtime(const Iterator begin, const EndIterator end, Pattern, bool & gave_up) noexcept {
+	using anchored = decltype(strip_anchors(Pattern{}));
+	using automaton = lazy_dfa_automaton<dfa_character_t<Iterator>, typename anchored::type>;
+	lazy_dfa_run<automaton> run{lazy_dfa_thread_cache<automaton>()};
+	if constexpr (anchored::begin) {
+		const auto out = automaton_search<true, anchored::end>(run, run, begin, end);
+		gave_up = run.gave_up();
+		return out;
+	} else {
+		using backward = lazy_dfa_automaton<dfa_character_t<Iterator>, typename anchored::type, true>;
+		lazy_dfa_run<backward> reverse_run{lazy_dfa_thread_cache<backward>()};
+		const auto out = automaton_search<false, anchored::end>(run, reverse_run, begin, end);
+		gave_up = run.gave_up() || reverse_run.gave_up();
+		return out;
+	}
+}
+
+// same results as the DFA engine (no captures, leftmost-longest search) without building all states at compile-time
+template <typename Iterator, typename EndIterator, typename Pattern> 
+constexpr inline auto lazy_dfa_match_re(const Iterator begin, const EndIterator end, Pattern pattern) noexcept {
+	static_assert(lazy_dfa_usable<Iterator, Pattern>(), "Lazy DFA engine needs 1-byte characters and a regular pattern (no back references, lookarounds, possessive repeats, or anchors inside) which fits into its limits.");
+	using automaton = lazy_dfa_automaton<dfa_character_t<Iterator>, typename decltype(strip_anchors(Pattern{}))::type>;
+	if (!CTRE_IS_CONSTANT_EVALUATED()) {
+		bool gave_up{false};
+		const auto out = lazy_dfa_match_runtime(begin, end, pattern, gave_up);
+		if (!gave_up) return out;
+	}
+	const lazy_dfa_simulation<automaton> simulation{};
+	return automaton_match(simulation, begin, end);
+}
+
+template <typename Iterator, typename EndIterator, typename Pattern> 
+constexpr inline auto lazy_dfa_search_re(const Iterator begin, const EndIterator end, Pattern pattern) noexcept {
+	static_assert(lazy_dfa_usable<Iterator, Pattern>(), "Lazy DFA engine needs 1-byte characters and a regular pattern (no back references, lookarounds, possessive repeats, or anchors inside) which fits into its limits.");
+	using anchored = decltype(strip_anchors(Pattern{}));
+	using automaton = lazy_dfa_automaton<dfa_character_t<Iterator>, typename anchored::type>;
+	if (!CTRE_IS_CONSTANT_EVALUATED()) {
+		bool gave_up{false};
+		const auto out = lazy_dfa_search_runtime(begin, end, pattern, gave_up);
+		if (!gave_up) return out;
+	}
+	const lazy_dfa_simulation<automaton> simulation{};
+	if constexpr (anchored::begin) {
+		return automaton_search<true, anchored::end>(simulation, simulation, begin, end);
+	} else {
+		const lazy_dfa_simulation<lazy_dfa_automaton<dfa_character_t<Iterator>, typename anchored::type, true>> reverse_simulation{};
+		return automaton_search<false, anchored::end>(simulation, reverse_simulation, begin, end);
+	}
+}
+
+}
+
+#endif
+
+#ifndef CTRE__ONE_PASS__HPP
+#define CTRE__ONE_PASS__HPP
+
+#include <cstdint>
+
+// limits of the one-pass matcher built at compile-time
+#ifndef CTRE_ONE_PASS_MAX_POSITIONS
+#define CTRE_ONE_PASS_MAX_POSITIONS 128
+#endif
+
+namespace ctre {
+
+// one-pass patterns: at every position at most one way through the pattern can continue with the next character,
+// so the matcher is deterministic and it records captures directly (Glushkov positions with capture tags on transitions)
+
+// tag bits: 2*Id is start of a capture, 2*Id+1 its end
+template <size_t Id> constexpr uint64_t one_pass_start_tag() noexcept {
+	return uint64_t{1} << (2 * Id);
+}
+
+template <size_t Id> constexpr uint64_t one_pass_end_tag() noexcept {
+	return uint64_t{1} << (2 * Id + 1);
+}
+
+template <size_t Positions> struct one_pass_nfa {
+	static constexpr size_t positions = Positions;
+	// position `Positions` is the start
+	static constexpr size_t start = Positions;
+	using set_type = position_set<(Positions + 64) / 64>;
+
+	byte_set symbols[Positions + 1]{};
+	set_type follow[Positions + 1]{};
+	uint64_t tags[Positions + 1][Positions + 1]{};
+	// tags written at the end of a match finishing at the position
+	uint64_t finish[Positions + 1]{};
+	set_type accepting{};
+	size_t used{0};
+	// two transitions with different tags, or a repeat of something empty
+	bool ambiguous{false};
+
+	constexpr void connect(size_t p, size_t q, uint64_t t) noexcept {
+		if (follow[p].test(q)) {
+			ambiguous = ambiguous || (tags[p][q] != t);
+		} else {
+			follow[p].insert(q);
+			tags[p][q] = t;
+		}
+	}
+};
+
+// tags of entering a fragment through its first positions, of leaving it through its last ones, and of matching it empty
+template <size_t N> struct one_pass_fragment {
+	typename one_pass_nfa<N>::set_type first{};
+	typename one_pass_nfa<N>::set_type last{};
+	bool nullable{true};
+	uint64_t empty{0};
+	uint64_t enter[N + 1]{};
+	uint64_t leave[N + 1]{};
+};
+
+template <size_t N> constexpr auto one_pass_concat(one_pass_nfa<N> & nfa, const one_pass_fragment<N> & lhs, const one_pass_fragment<N> & rhs) noexcept {
+	one_pass_fragment<N> out = lhs;
+	for (size_t p = 0; p < N; ++p) {
+		if (!lhs.last.test(p)) continue;
+		for (size_t q = 0; q < N; ++q) {
+			if (rhs.first.test(q)) nfa.connect(p, q, lhs.leave[p] | rhs.enter[q]);
+		}
+	}
+	out.last = rhs.last;
+	for (size_t p = 0; p < N; ++p) {
+		if (lhs.nullable && rhs.first.test(p)) {
+			out.first.insert(p);
+			out.enter[p] = lhs.empty | rhs.enter[p];
+		}
+		if (rhs.last.test(p)) {
+			out.leave[p] = rhs.leave[p];
+		} else if (rhs.nullable && lhs.last.test(p)) {
+			out.last.insert(p);
+			out.leave[p] = lhs.leave[p] | rhs.empty;
+		}
+	}
+	out.nullable = lhs.nullable && rhs.nullable;
+	out.empty = lhs.empty | rhs.empty;
+	return out;
+}
+
+template <size_t N> constexpr auto one_pass_loop(one_pass_nfa<N> & nfa, const one_pass_fragment<N> & fragment) noexcept {
+	for (size_t p = 0; p < N; ++p) {
+		if (!fragment.last.test(p)) continue;
+		for (size_t q = 0; q < N; ++q) {
+			if (fragment.first.test(q)) nfa.connect(p, q, fragment.leave[p] | fragment.enter[q]);
+		}
+	}
+	return fragment;
+}
+
+// greedy one tries the content first (with its empty match), lazy one skips it first
+template <bool Greedy, size_t N> constexpr auto one_pass_optional(one_pass_fragment<N> fragment) noexcept {
+	if (!Greedy || !fragment.nullable) fragment.empty = 0;
+	fragment.nullable = true;
+	return fragment;
+}
+
+template <typename CharT, size_t N, typename... Content> constexpr auto one_pass_sequence(one_pass_nfa<N> & nfa, ctll::list<Content...>) noexcept;
+
+template <typename CharT, size_t N, typename CharacterLike> constexpr auto one_pass_of(one_pass_nfa<N> & nfa, CharacterLike) noexcept {
+	const size_t p = nfa.used++;
+	nfa.symbols[p] = make_byte_set<CharT>(ctll::list<CharacterLike>{});
+	one_pass_fragment<N> out;
+	out.first.insert(p);
+	out.last.insert(p);
+	out.nullable = false;
+	return out;
+}
+
+template <typename CharT, size_t N, auto... Str> constexpr auto one_pass_of(one_pass_nfa<N> & nfa, string<Str...>) noexcept {
+	return one_pass_sequence<CharT>(nfa, ctll::list<character<Str>...>{});
+}
+
+template <typename CharT, size_t N> constexpr auto one_pass_of(one_pass_nfa<N> &, empty) noexcept {
+	return one_pass_fragment<N>{};
+}
+
+template <typename CharT, size_t N, typename... Content> constexpr auto one_pass_of(one_pass_nfa<N> & nfa, sequence<Content...>) noexcept {
+	return one_pass_sequence<CharT>(nfa, ctll::list<Content...>{});
+}
+
+template <size_t Id, size_t N> constexpr auto one_pass_capture(one_pass_fragment<N> fragment) noexcept {
+	for (size_t p = 0; p < N; ++p) {
+		if (fragment.first.test(p)) fragment.enter[p] |= one_pass_start_tag<Id>();
+		if (fragment.last.test(p)) fragment.leave[p] |= one_pass_end_tag<Id>();
+	}
+	if (fragment.nullable) fragment.empty |= one_pass_start_tag<Id>() | one_pass_end_tag<Id>();
+	return fragment;
+}
+
+template <typename CharT, size_t N, size_t Id, typename... Content> constexpr auto one_pass_of(one_pass_nfa<N> & nfa, capture<Id, Content...>) noexcept {
+	return one_pass_capture<Id>(one_pass_sequence<CharT>(nfa, ctll::list<Content...>{}));
+}
+
+template <typename CharT, size_t N, size_t Id, typename Name, typename... Content> constexpr auto one_pass_of(one_pass_nfa<N> & nfa, capture_with_name<Id, Name, Content...>) noexcept {
+	return one_pass_capture<Id>(one_pass_sequence<CharT>(nfa, ctll::list<Content...>{}));
+}
+
+template <typename CharT, size_t N, typename... Opts> constexpr auto one_pass_of(one_pass_nfa<N> & nfa, select<Opts...>) noexcept {
+	one_pass_fragment<N> out;
+	out.nullable = false;
+	const auto add = [&](const one_pass_fragment<N> & option) {
+		out.first |= option.first;
+		out.last |= option.last;
+		for (size_t p = 0; p < N; ++p) {
+			if (option.first.test(p)) out.enter[p] = option.enter[p];
+			if (option.last.test(p)) out.leave[p] = option.leave[p];
+		}
+		// the first option matching empty wins
+		if (option.nullable && !out.nullable) {
+			out.nullable = true;
+			out.empty = option.empty;
+		}
+	};
+	(add(one_pass_of<CharT>(nfa, Opts{})), ...);
+	return out;
+}
+
+// x{A,B} => A copies and nested optional ones x(x(x)?)?, x{A,} => A-1 copies and x+
+template <typename CharT, bool Greedy, size_t N, typename... Content> constexpr one_pass_fragment<N> one_pass_optional_chain(one_pass_nfa<N> & nfa, ctll::list<Content...> content, size_t count) noexcept {
+	auto copy = one_pass_sequence<CharT>(nfa, content);
+	if (count > 1) {
+		copy = one_pass_concat(nfa, copy, one_pass_optional_chain<CharT, Greedy>(nfa, content, count - 1));
+	}
+	return one_pass_optional<Greedy>(copy);
+}
+
+template <typename CharT, size_t A, size_t B, bool Greedy, size_t N, typename... Content> constexpr auto one_pass_repeat(one_pass_nfa<N> & nfa, ctll::list<Content...> content) noexcept {
+	one_pass_fragment<N> out;
+	if constexpr (B == 0) {
+		for (size_t i = 1; i < A; ++i) {
+			out = one_pass_concat(nfa, out, one_pass_sequence<CharT>(nfa, content));
+		}
+		auto tail = one_pass_loop(nfa, one_pass_sequence<CharT>(nfa, content));
+		// an empty iteration is a way around the loop
+		nfa.ambiguous = nfa.ambiguous || tail.nullable;
+		out = one_pass_concat(nfa, out, (A == 0) ? one_pass_optional<Greedy>(tail) : tail);
+	} else {
+		for (size_t i = 0; i < A; ++i) {
+			out = one_pass_concat(nfa, out, one_pass_sequence<CharT>(nfa, content));
+		}
+		if constexpr (B > A) {
+			const auto chain = one_pass_optional_chain<CharT, Greedy>(nfa, content, B - A);
+			out = one_pass_concat(nfa, out, chain);
+		}
+		nfa.ambiguous = nfa.ambiguous || (out.nullable && A > 0);
+	}
+	return out;
+}
+
+template <typename CharT, size_t N, typename... Content> constexpr auto one_pass_of(one_pass_nfa<N> & nfa, optional<Content...>) noexcept {
+	return one_pass_optional<true>(one_pass_sequence<CharT>(nfa, ctll::list<Content...>{}));
+}
+
+template <typename CharT, size_t N, typename... Content> constexpr auto one_pass_of(one_pass_nfa<N> & nfa, lazy_optional<Content...>) noexcept {
+	return one_pass_optional<false>(one_pass_sequence<CharT>(nfa, ctll::list<Content...>{}));
+}
+
+template <typename CharT, size_t N, typename... Content> constexpr auto one_pass_of(one_pass_nfa<N> & nfa, plus<Content...>) noexcept {
+	return one_pass_repeat<CharT, 1, 0, true>(nfa, ctll::list<Content...>{});
+}
+
+template <typename CharT, size_t N, typename... Content> constexpr auto one_pass_of(one_pass_nfa<N> & nfa, lazy_plus<Content...>) noexcept {
+	return one_pass_repeat<CharT, 1, 0, false>(nfa, ctll::list<Content...>{});
+}
+
+template <typename CharT, size_t N, typename... Content> constexpr auto one_pass_of(one_pass_nfa<N> & nfa, star<Content...>) noexcept {
+	return one_pass_repeat<CharT, 0, 0, true>(nfa, ctll::list<Content...>{});
+}
+
+template <typename CharT, size_t N, typename... Content> constexpr auto one_pass_of(one_pass_nfa<N> & nfa, lazy_star<Content...>) noexcept {
+	return one_pass_repeat<CharT, 0, 0, false>(nfa, ctll::list<Content...>{});
+}
+
+template <typename CharT, size_t N, size_t A, size_t B, typename... Content> constexpr auto one_pass_of(one_pass_nfa<N> & nfa, repeat<A, B, Content...>) noexcept {
+	return one_pass_repeat<CharT, A, B, true>(nfa, ctll::list<Content...>{});
+}
+
+template <typename CharT, size_t N, size_t A, size_t B, typename... Content> constexpr auto one_pass_of(one_pass_nfa<N> & nfa, lazy_repeat<A, B, Content...>) noexcept {
+	return one_pass_repeat<CharT, A, B, false>(nfa, ctll::list<Content...>{});
+}
+
+template <typename CharT, size_t N, typename... Content> constexpr auto one_pass_sequence(one_pass_nfa<N> & nfa, ctll::list<Content...>) noexcept {
+	one_pass_fragment<N> out;
+	((out = one_pass_concat(nfa, out, one_pass_of<CharT>(nfa, Content{}))), ...);
+	return out;
+}
+
+template <typename CharT, typename Pattern> constexpr auto build_one_pass(Pattern) noexcept {
+	one_pass_nfa<glushkov_positions(Pattern{})> nfa;
+	const auto top = one_pass_of<CharT>(nfa, Pattern{});
+	nfa.accepting = top.last;
+	for (size_t p = 0; p < nfa.positions; ++p) {
+		if (top.first.test(p)) nfa.connect(nfa.start, p, top.enter[p]);
+		if (top.last.test(p)) nfa.finish[p] = top.leave[p];
+	}
+	if (top.nullable) {
+		nfa.accepting.insert(nfa.start);
+		nfa.finish[nfa.start] = top.empty;
+	}
+	return nfa;
+}
+
+// deterministic transitions over byte classes, `States` is the dead state
+template <size_t States, size_t Classes> struct one_pass_table {
+	struct transition {
+		uint32_t target;
+		uint64_t tags;
+	};
+	transition next[States][Classes]{};
+	uint64_t finish[States]{};
+	bool accepting[States]{};
+	bool deterministic{true};
+};
+
+template <size_t Classes, typename NFA> constexpr auto make_one_pass_table(const NFA & nfa, const dfa_byte_classes & classes) noexcept {
+	constexpr size_t states = NFA::positions + 1;
+	one_pass_table<states, Classes> out;
+	out.deterministic = !nfa.ambiguous;
+	// one byte of every class
+	unsigned representative[Classes]{};
+	for (unsigned c = 256; c-- > 0;) {
+		representative[classes.of[c]] = c;
+	}
+	for (size_t s = 0; s < states; ++s) {
+		for (size_t k = 0; k < Classes; ++k) {
+			out.next[s][k] = {static_cast<uint32_t>(states), 0};
+		}
+		out.accepting[s] = nfa.accepting.test(s);
+		out.finish[s] = nfa.finish[s];
+		for (size_t q = 0; q < NFA::positions; ++q) {
+			if (!nfa.follow[s].test(q)) continue;
+			for (size_t k = 0; k < Classes; ++k) {
+				if (!nfa.symbols[q].test(static_cast<unsigned char>(representative[k]))) continue;
+				auto & transition = out.next[s][k];
+				// more than one way to continue
+				if (transition.target != states) out.deterministic = false;
+				transition.target = static_cast<uint32_t>(q);
+				transition.tags = nfa.tags[s][q];
+			}
+		}
+	}
+	return out;
+}
+
+template <typename CharT, typename Pattern> struct one_pass_automaton {
+	static constexpr auto nfa = build_one_pass<CharT>(Pattern{});
+	static constexpr auto classes = make_dfa_byte_classes(nfa);
+	static constexpr auto table = make_one_pass_table<classes.count>(nfa, classes);
+	static constexpr size_t start = nfa.start;
+	static constexpr size_t dead = nfa.start + 1;
+};
+
+// conditions (captures are identified by bits in 64bit masks)
+
+template <size_t... Ids, typename... Names> constexpr size_t one_pass_highest_capture(ctll::list<captured_content<Ids, Names>...>) noexcept {
+	size_t out{0};
+	((out = (Ids > out) ? Ids : out), ...);
+	return out;
+}
+
+template <typename Pattern> constexpr bool one_pass_compatible(Pattern) noexcept {
+	using anchored = decltype(strip_anchors(Pattern{}));
+	return regular_compatible<false>(typename anchored::type{}) && glushkov_positions(typename anchored::type{}) <= CTRE_ONE_PASS_MAX_POSITIONS && one_pass_highest_capture(find_captures(Pattern{})) < 32;
+}
+
+template <typename Iterator, typename Pattern> constexpr bool one_pass_usable() noexcept {
+	if constexpr (is_dfa_character_v<dfa_character_t<Iterator>> && one_pass_compatible(Pattern{})) {
+		return one_pass_automaton<dfa_character_t<Iterator>, typename decltype(strip_anchors(Pattern{}))::type>::table.deterministic;
+	} else {
+		return false;
+	}
+}
+
+template <typename R, typename Iterator, size_t... Ids, typename... Names> 
+constexpr CTRE_FORCE_INLINE void one_pass_captures(R & out, const Iterator * marks, uint64_t written, ctll::list<captured_content<Ids, Names>...>) noexcept {
+	const auto assign = [&](auto id) {
+		constexpr size_t Id = decltype(id)::value;
+		if (written & one_pass_end_tag<Id>()) {
+			out.template start_capture<Id>(marks[2 * Id]).template end_capture<Id>(marks[2 * Id + 1]);
+		}
+	};
+	(assign(std::integral_constant<size_t, Ids>{}), ...);
+}
+
+// whole subject matched with same captures as backtracking would find
+template <typename Iterator, typename EndIterator, typename Pattern> 
+constexpr inline auto one_pass_match_re(const Iterator begin, const EndIterator end, Pattern) noexcept {
+	static_assert(one_pass_usable<Iterator, Pattern>(), "One-pass matcher needs 1-byte characters and a regular pattern where at most one way through it can continue with every character.");
+	using automaton = one_pass_automaton<dfa_character_t<Iterator>, typename decltype(strip_anchors(Pattern{}))::type>;
+	constexpr auto & table = automaton::table;
+	constexpr auto captures = find_captures(Pattern{});
+	using return_type = decltype(regex_results(std::declval<Iterator>(), captures));
+
+	Iterator marks[2 * (one_pass_highest_capture(captures) + 1)]{};
+	uint64_t written{0};
+	const auto record = [&](uint64_t tags, const Iterator & position) {
+		written |= tags;
+		for (; tags; tags &= tags - 1) {
+			marks[lowest_bit_index(tags)] = position;
+		}
+	};
+
+	size_t state = automaton::start;
+	Iterator current = begin;
+	for (; end != current; ++current) {
+		const auto & transition = table.next[state][automaton::classes.of[static_cast<unsigned char>(*current)]];
+		// staying in the same state doesn't wait for the load (`[a-z]+` parts)
+		if (transition.target == state && !transition.tags) continue;
+		if (transition.target == automaton::dead) return return_type{};
+		if (transition.tags) record(transition.tags, current);
+		state = transition.target;
+	}
+	if (!table.accepting[state]) return return_type{};
+	record(table.finish[state], current);
+
+	return_type out{};
+	out.set_start_mark(begin).set_end_mark(current).matched();
+	one_pass_captures(out, marks, written, captures);
+	return out;
+}
+
+}
+
+#endif
+
+#ifndef CTRE__PIKE_VM__HPP
+#define CTRE__PIKE_VM__HPP
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace ctre {
+
+// Thompson NFA simulated as Pike VM: all threads move over the subject together,
+// so it's O(subject * program) with captures and without recursion over the subject
+
+enum class pike_op: uint8_t {
+	character, split, jump, save, assert_begin, assert_end, match
+};
+
+struct pike_instruction {
+	pike_op op{pike_op::match};
+	size_t first{0}; // character: predicate index, split / jump: target (preferred one), save: slot
+	size_t second{0}; // split: the other target
+};
+
+// all distinct character-like types (predicates) of the pattern
+
+template <typename... Out> constexpr auto pike_predicates(ctll::list<Out...> out, ctll::list<>) noexcept {
+	return out;
+}
+
+template <typename... Out, typename CharacterLike, typename... Tail> constexpr auto pike_predicates(ctll::list<Out...>, ctll::list<CharacterLike, Tail...>) noexcept {
+	if constexpr ((std::is_same_v<CharacterLike, Out> || ... || false)) {
+		return pike_predicates(ctll::list<Out...>{}, ctll::list<Tail...>{});
+	} else {
+		return pike_predicates(ctll::list<Out..., CharacterLike>{}, ctll::list<Tail...>{});
+	}
+}
+
+template <typename... Out, auto... Str, typename... Tail> constexpr auto pike_predicates(ctll::list<Out...> out, ctll::list<string<Str...>, Tail...>) noexcept {
+	return pike_predicates(out, ctll::list<character<Str>..., Tail...>{});
+}
+
+template <typename... Out, typename... Tail> constexpr auto pike_predicates(ctll::list<Out...> out, ctll::list<empty, Tail...>) noexcept {
+	return pike_predicates(out, ctll::list<Tail...>{});
+}
+
+template <typename... Out, typename... Tail> constexpr auto pike_predicates(ctll::list<Out...> out, ctll::list<assert_begin, Tail...>) noexcept {
+	return pike_predicates(out, ctll::list<Tail...>{});
+}
+
+template <typename... Out, typename... Tail> constexpr auto pike_predicates(ctll::list<Out...> out, ctll::list<assert_end, Tail...>) noexcept {
+	return pike_predicates(out, ctll::list<Tail...>{});
+}
+
+template <typename... Out, typename... Content, typename... Tail> constexpr auto pike_predicates(ctll::list<Out...> out, ctll::list<sequence<Content...>, Tail...>) noexcept {
+	return pike_predicates(out, ctll::list<Content..., Tail...>{});
+}
+
+template <typename... Out, typename... Opts, typename... Tail> constexpr auto pike_predicates(ctll::list<Out...> out, ctll::list<select<Opts...>, Tail...>) noexcept {
+	return pike_predicates(out, ctll::list<Opts..., Tail...>{});
+}
+
+template <typename... Out, size_t Id, typename... Content, typename... Tail> constexpr auto pike_predicates(ctll::list<Out...> out, ctll::list<capture<Id, Content...>, Tail...>) noexcept {
+	return pike_predicates(out, ctll::list<Content..., Tail...>{});
+}
+
+template <typename... Out, size_t Id, typename Name, typename... Content, typename... Tail> constexpr auto pike_predicates(ctll::list<Out...> out, ctll::list<capture_with_name<Id, Name, Content...>, Tail...>) noexcept {
+	return pike_predicates(out, ctll::list<Content..., Tail...>{});
+}
+
+template <typename... Out, typename... Content, typename... Tail> constexpr auto pike_predicates(ctll::list<Out...> out, ctll::list<optional<Content...>, Tail...>) noexcept {
+	return pike_predicates(out, ctll::list<Content..., Tail...>{});
+}
+
+template <typename... Out, typename... Content, typename... Tail> constexpr auto pike_predicates(ctll::list<Out...> out, ctll::list<lazy_optional<Content...>, Tail...>) noexcept {
+	return pike_predicates(out, ctll::list<Content..., Tail...>{});
+}
+
+template <typename... Out, typename... Content, typename... Tail> constexpr auto pike_predicates(ctll::list<Out...> out, ctll::list<plus<Content...>, Tail...>) noexcept {
+	return pike_predicates(out, ctll::list<Content..., Tail...>{});
+}
+
+template <typename... Out, typename... Content, typename... Tail> constexpr auto pike_predicates(ctll::list<Out...> out, ctll::list<lazy_plus<Content...>, Tail...>) noexcept {
+	return pike_predicates(out, ctll::list<Content..., Tail...>{});
+}
+
+template <typename... Out, typename... Content, typename... Tail> constexpr auto pike_predicates(ctll::list<Out...> out, ctll::list<star<Content...>, Tail...>) noexcept {
+	return pike_predicates(out, ctll::list<Content..., Tail...>{});
+}
+
+template <typename... Out, typename... Content, typename... Tail> constexpr auto pike_predicates(ctll::list<Out...> out, ctll::list<lazy_star<Content...>, Tail...>) noexcept {
+	return pike_predicates(out, ctll::list<Content..., Tail...>{});
+}
+
+template <typename... Out, size_t A, size_t B, typename... Content, typename... Tail> constexpr auto pike_predicates(ctll::list<Out...> out, ctll::list<repeat<A, B, Content...>, Tail...>) noexcept {
+	return pike_predicates(out, ctll::list<Content..., Tail...>{});
+}
+
+template <typename... Out, size_t A, size_t B, typename... Content, typename... Tail> constexpr auto pike_predicates(ctll::list<Out...> out, ctll::list<lazy_repeat<A, B, Content...>, Tail...>) noexcept {
+	return pike_predicates(out, ctll::list<Content..., Tail...>{});
+}
+
+template <typename T, typename... Ts> constexpr size_t pike_index_of(ctll::list<Ts...>) noexcept {
+	constexpr bool same[] = {false, std::is_same_v<T, Ts>...};
+	for (size_t i = 1; i < sizeof(same); ++i) {
+		if (same[i]) return i - 1;
+	}
+	return sizeof...(Ts);
+}
+
+template <size_t Id, typename Name> constexpr size_t captured_id(captured_content<Id, Name>) noexcept {
+	return Id;
+}
+
+template <size_t Id, typename... Captures> constexpr size_t pike_capture_slot(ctll::list<Captures...>) noexcept {
+	constexpr size_t ids[] = {0, captured_id(Captures{})...};
+	for (size_t i = 1; i < sizeof(ids) / sizeof(size_t); ++i) {
+		if (ids[i] == Id) return 2 * i;
+	}
+	return 0;
+}
+
+// number of instructions
+
+template <typename CharacterLike> constexpr size_t pike_size(CharacterLike) noexcept {
+	return 1;
+}
+
+template <typename... Content> constexpr size_t pike_size_sequence(ctll::list<Content...>) noexcept {
+	return (pike_size(Content{}) + ... + 0);
+}
+
+template <auto... Str> constexpr size_t pike_size(string<Str...>) noexcept {
+	return sizeof...(Str);
+}
+
+constexpr size_t pike_size(empty) noexcept {
+	return 0;
+}
+
+template <typename... Content> constexpr size_t pike_size(sequence<Content...>) noexcept {
+	return pike_size_sequence(ctll::list<Content...>{});
+}
+
+template <typename... Opts> constexpr size_t pike_size(select<Opts...>) noexcept {
+	return pike_size_sequence(ctll::list<Opts...>{}) + 2 * (sizeof...(Opts) > 0 ? sizeof...(Opts) - 1 : 0);
+}
+
+template <size_t Id, typename... Content> constexpr size_t pike_size(capture<Id, Content...>) noexcept {
+	return pike_size_sequence(ctll::list<Content...>{}) + 2;
+}
+
+template <size_t Id, typename Name, typename... Content> constexpr size_t pike_size(capture_with_name<Id, Name, Content...>) noexcept {
+	return pike_size_sequence(ctll::list<Content...>{}) + 2;
+}
+
+// x{A,B} => A copies and B-A nested optional copies, x{A,} => A-1 copies and x+, x* => x{0,}
+template <size_t A, size_t B, typename... Content> constexpr size_t pike_repeat_size() noexcept {
+	const size_t content = pike_size_sequence(ctll::list<Content...>{});
+	if constexpr (B == 0) {
+		return A == 0 ? content + 2 : A * content + 1;
+	} else {
+		return A * content + (B - A) * (content + 1);
+	}
+}
+
+template <typename... Content> constexpr size_t pike_size(optional<Content...>) noexcept {
+	return pike_repeat_size<0, 1, Content...>();
+}
+
+template <typename... Content> constexpr size_t pike_size(lazy_optional<Content...>) noexcept {
+	return pike_repeat_size<0, 1, Content...>();
+}
+
+template <typename... Content> constexpr size_t pike_size(plus<Content...>) noexcept {
+	return pike_repeat_size<1, 0, Content...>();
+}
+
+template <typename... Content> constexpr size_t pike_size(lazy_plus<Content...>) noexcept {
+	return pike_repeat_size<1, 0, Content...>();
+}
+
+template <typename... Content> constexpr size_t pike_size(star<Content...>) noexcept {
+	return pike_repeat_size<0, 0, Content...>();
+}
+
+template <typename... Content> constexpr size_t pike_size(lazy_star<Content...>) noexcept {
+	return pike_repeat_size<0, 0, Content...>();
+}
+
+template <size_t A, size_t B, typename... Content> constexpr size_t pike_size(repeat<A, B, Content...>) noexcept {
+	return pike_repeat_size<A, B, Content...>();
+}
+
+template <size_t A, size_t B, typename... Content> constexpr size_t pike_size(lazy_repeat<A, B, Content...>) noexcept {
+	return pike_repeat_size<A, B, Content...>();
+}
+
+// code generation
+
+template <size_t N> struct pike_code {
+	pike_instruction code[N]{};
+	size_t used{0};
+
+	constexpr size_t push(pike_op op, size_t first = 0, size_t second = 0) noexcept {
+		code[used] = pike_instruction{op, first, second};
+		return used++;
+	}
+};
+
+template <typename Predicates, typename Captures> struct pike_context {
+	template <typename CharacterLike> static constexpr size_t predicate() noexcept {
+		return pike_index_of<CharacterLike>(Predicates{});
+	}
+	template <size_t Id> static constexpr size_t slot() noexcept {
+		return pike_capture_slot<Id>(Captures{});
+	}
+};
+
+template <typename Context, size_t N, typename... Content> constexpr void pike_emit_sequence(pike_code<N> & out, ctll::list<Content...>) noexcept;
+
+template <typename Context, size_t N, typename CharacterLike> constexpr void pike_emit(pike_code<N> & out, CharacterLike) noexcept {
+	out.push(pike_op::character, Context::template predicate<CharacterLike>());
+}
+
+template <typename Context, size_t N, auto... Str> constexpr void pike_emit(pike_code<N> & out, string<Str...>) noexcept {
+	(out.push(pike_op::character, Context::template predicate<character<Str>>()), ...);
+}
+
+template <typename Context, size_t N> constexpr void pike_emit(pike_code<N> &, empty) noexcept { }
+
+template <typename Context, size_t N> constexpr void pike_emit(pike_code<N> & out, assert_begin) noexcept {
+	out.push(pike_op::assert_begin);
+}
+
+template <typename Context, size_t N> constexpr void pike_emit(pike_code<N> & out, assert_end) noexcept {
+	out.push(pike_op::assert_end);
+}
+
+template <typename Context, size_t N, typename... Content> constexpr void pike_emit(pike_code<N> & out, sequence<Content...>) noexcept {
+	pike_emit_sequence<Context>(out, ctll::list<Content...>{});
+}
+
+template <typename Context, size_t N, size_t Id, typename... Content> constexpr void pike_emit(pike_code<N> & out, capture<Id, Content...>) noexcept {
+	out.push(pike_op::save, Context::template slot<Id>());
+	pike_emit_sequence<Context>(out, ctll::list<Content...>{});
+	out.push(pike_op::save, Context::template slot<Id>() + 1);
+}
+
+template <typename Context, size_t N, size_t Id, typename Name, typename... Content> constexpr void pike_emit(pike_code<N> & out, capture_with_name<Id, Name, Content...>) noexcept {
+	out.push(pike_op::save, Context::template slot<Id>());
+	pike_emit_sequence<Context>(out, ctll::list<Content...>{});
+	out.push(pike_op::save, Context::template slot<Id>() + 1);
+}
+
+// split to option / rest, option, jump to the end
+template <typename Context, size_t N> constexpr void pike_emit_options(pike_code<N> &, ctll::list<>) noexcept { }
+
+template <typename Context, size_t N, typename Head, typename... Tail> constexpr void pike_emit_options(pike_code<N> & out, ctll::list<Head, Tail...>) noexcept {
+	if constexpr (sizeof...(Tail) == 0) {
+		pike_emit<Context>(out, Head{});
+	} else {
+		const size_t split = out.push(pike_op::split, out.used + 1);
+		pike_emit<Context>(out, Head{});
+		const size_t jump = out.push(pike_op::jump);
+		out.code[split].second = out.used;
+		pike_emit_options<Context>(out, ctll::list<Tail...>{});
+		out.code[jump].first = out.used;
+	}
+}
+
+template <typename Context, size_t N, typename... Opts> constexpr void pike_emit(pike_code<N> & out, select<Opts...>) noexcept {
+	pike_emit_options<Context>(out, ctll::list<Opts...>{});
+}
+
+// preferred target of split is `first`, lazy repeats prefer to skip
+constexpr void pike_set_split(pike_instruction & split, size_t inside, size_t outside, bool lazy) noexcept {
+	split.first = lazy ? outside : inside;
+	split.second = lazy ? inside : outside;
+}
+
+template <typename Context, size_t A, size_t B, bool Lazy, size_t N, typename... Content> constexpr void pike_emit_repeat(pike_code<N> & out, ctll::list<Content...> content) noexcept {
+	if constexpr (B == 0) {
+		if constexpr (A == 0) {
+			const size_t split = out.push(pike_op::split);
+			pike_emit_sequence<Context>(out, content);
+			out.push(pike_op::jump, split);
+			pike_set_split(out.code[split], split + 1, out.used, Lazy);
+		} else {
+			for (size_t i = 1; i < A; ++i) {
+				pike_emit_sequence<Context>(out, content);
+			}
+			const size_t loop = out.used;
+			pike_emit_sequence<Context>(out, content);
+			const size_t split = out.push(pike_op::split);
+			pike_set_split(out.code[split], loop, split + 1, Lazy);
+		}
+	} else {
+		for (size_t i = 0; i < A; ++i) {
+			pike_emit_sequence<Context>(out, content);
+		}
+		size_t splits[B - A + 1]{};
+		for (size_t i = A; i < B; ++i) {
+			splits[i - A] = out.push(pike_op::split);
+			pike_emit_sequence<Context>(out, content);
+		}
+		for (size_t i = A; i < B; ++i) {
+			pike_set_split(out.code[splits[i - A]], splits[i - A] + 1, out.used, Lazy);
+		}
+	}
+}
+
+template <typename Context, size_t N, typename... Content> constexpr void pike_emit(pike_code<N> & out, optional<Content...>) noexcept {
+	pike_emit_repeat<Context, 0, 1, false>(out, ctll::list<Content...>{});
+}
+
+template <typename Context, size_t N, typename... Content> constexpr void pike_emit(pike_code<N> & out, lazy_optional<Content...>) noexcept {
+	pike_emit_repeat<Context, 0, 1, true>(out, ctll::list<Content...>{});
+}
+
+template <typename Context, size_t N, typename... Content> constexpr void pike_emit(pike_code<N> & out, plus<Content...>) noexcept {
+	pike_emit_repeat<Context, 1, 0, false>(out, ctll::list<Content...>{});
+}
+
+template <typename Context, size_t N, typename... Content> constexpr void pike_emit(pike_code<N> & out, lazy_plus<Content...>) noexcept {
+	pike_emit_repeat<Context, 1, 0, true>(out, ctll::list<Content...>{});
+}
+
+template <typename Context, size_t N, typename... Content> constexpr void pike_emit(pike_code<N> & out, star<Content...>) noexcept {
+	pike_emit_repeat<Context, 0, 0, false>(out, ctll::list<Content...>{});
+}
+
+template <typename Context, size_t N, typename... Content> constexpr void pike_emit(pike_code<N> & out, lazy_star<Content...>) noexcept {
+	pike_emit_repeat<Context, 0, 0, true>(out, ctll::list<Content...>{});
+}
+
+template <typename Context, size_t N, size_t A, size_t B, typename... Content> constexpr void pike_emit(pike_code<N> & out, repeat<A, B, Content...>) noexcept {
+	pike_emit_repeat<Context, A, B, false>(out, ctll::list<Content...>{});
+}
+
+template <typename Context, size_t N, size_t A, size_t B, typename... Content> constexpr void pike_emit(pike_code<N> & out, lazy_repeat<A, B, Content...>) noexcept {
+	pike_emit_repeat<Context, A, B, true>(out, ctll::list<Content...>{});
+}
+
+template <typename Context, size_t N, typename... Content> constexpr void pike_emit_sequence(pike_code<N> & out, ctll::list<Content...>) noexcept {
+	(pike_emit<Context>(out, Content{}), ...);
+}
+
+// save 0, pattern, (assert end for whole subject,) save 1, match
+template <typename Context, size_t N, typename Pattern> constexpr auto pike_compile(Pattern, bool whole) noexcept {
+	pike_code<N> out;
+	out.push(pike_op::save, 0);
+	pike_emit<Context>(out, Pattern{});
+	if (whole) out.push(pike_op::assert_end);
+	out.push(pike_op::save, 1);
+	out.push(pike_op::match);
+	return out;
+}
+
+template <typename CharT, typename... Predicates> struct pike_byte_predicates {
+	static constexpr byte_set value[] = {byte_set{}, make_byte_set<CharT>(ctll::list<Predicates>{})...};
+};
+
+template <typename Pattern, bool Whole> struct pike_program {
+	using captures = decltype(find_captures(Pattern{}));
+	using predicates = decltype(pike_predicates(ctll::list<>{}, ctll::list<Pattern>{}));
+	using context = pike_context<predicates, captures>;
+
+	static constexpr size_t size = pike_size(Pattern{}) + (Whole ? 4 : 3);
+	static constexpr size_t slots = 2 + 2 * ctll::size(captures{});
+	static constexpr auto code = pike_compile<context, size>(Pattern{}, Whole);
+
+	template <typename CharT, typename... Ps> static constexpr CTRE_FORCE_INLINE bool test_predicate(ctll::list<Ps...>, size_t index, CharT c) noexcept {
+		if constexpr (sizeof(CharT) == 1 && std::is_integral_v<CharT>) {
+			return pike_byte_predicates<CharT, Ps...>::value[index + 1].test(static_cast<unsigned char>(c));
+		} else {
+			size_t i{0};
+			return (((i++ == index) && Ps::match_char(c)) || ... || false);
+		}
+	}
+	template <typename CharT> static constexpr CTRE_FORCE_INLINE bool test(size_t index, CharT c) noexcept {
+		return test_predicate(predicates{}, index, c);
+	}
+};
+
+// the machine is generic over positions (iterators, or offsets for streaming)
+
+enum class pike_end: uint8_t {
+	no, yes, unknown // unknown => threads waiting on `$` are kept until finish()
+};
+
+template <size_t Slots, typename Position> struct pike_captures {
+	Position position[Slots]{};
+	bool set[Slots]{};
+};
+
+template <typename Program, typename Position> struct pike_machine {
+	static constexpr size_t size = Program::size;
+	using captures_type = pike_captures<Program::slots, Position>;
+
+	struct thread_list {
+		size_t count{0};
+		size_t pc[size]{};
+		captures_type captures[size]{};
+	};
+
+	thread_list lists[2]{};
+	size_t current{0};
+	// pc already visited while building the list with this generation
+	size_t visited[size]{};
+	size_t generation{1};
+
+	captures_type best{};
+	bool matched{false};
+
+	constexpr bool empty() const noexcept {
+		return lists[current].count == 0;
+	}
+
+	constexpr void add(thread_list & list, size_t pc, captures_type & captures, const Position & position, bool at_begin, pike_end at_end) noexcept {
+		if (visited[pc] == generation) return;
+		visited[pc] = generation;
+		const pike_instruction & instruction = Program::code.code[pc];
+		switch (instruction.op) {
+			case pike_op::jump:
+				add(list, instruction.first, captures, position, at_begin, at_end);
+				return;
+			case pike_op::split:
+				add(list, instruction.first, captures, position, at_begin, at_end);
+				add(list, instruction.second, captures, position, at_begin, at_end);
+				return;
+			case pike_op::save: {
+				const Position previous = captures.position[instruction.first];
+				const bool was_set = captures.set[instruction.first];
+				captures.position[instruction.first] = position;
+				captures.set[instruction.first] = true;
+				add(list, pc + 1, captures, position, at_begin, at_end);
+				captures.position[instruction.first] = previous;
+				captures.set[instruction.first] = was_set;
+				return;
+			}
+			case pike_op::assert_begin:
+				if (at_begin) add(list, pc + 1, captures, position, at_begin, at_end);
+				return;
+			case pike_op::assert_end:
+				if (at_end == pike_end::yes) {
+					add(list, pc + 1, captures, position, at_begin, at_end);
+					return;
+				} else if (at_end == pike_end::no) {
+					return;
+				}
+				break; // wait for finish()
+			case pike_op::character:
+			case pike_op::match:
+				break;
+		}
+		list.pc[list.count] = pc;
+		list.captures[list.count] = captures;
+		++list.count;
+	}
+
+	// new thread with the lowest priority
+	constexpr void start(const Position & position, bool at_begin, pike_end at_end) noexcept {
+		captures_type captures{};
+		add(lists[current], 0, captures, position, at_begin, at_end);
+	}
+
+	// consume one character, `position` is after it
+	template <typename CharT> constexpr void step(CharT c, const Position & position, pike_end at_end) noexcept {
+		thread_list & from = lists[current];
+		thread_list & to = lists[current ^ 1];
+		to.count = 0;
+		++generation;
+		for (size_t i = 0; i < from.count; ++i) {
+			const pike_instruction & instruction = Program::code.code[from.pc[i]];
+			if (instruction.op == pike_op::character) {
+				if (Program::test(instruction.first, c)) {
+					add(to, from.pc[i] + 1, from.captures[i], position, false, at_end);
+				}
+			} else if (instruction.op == pike_op::match) {
+				// threads with lower priority are not needed anymore
+				best = from.captures[i];
+				matched = true;
+				break;
+			}
+		}
+		current ^= 1;
+	}
+
+	// end of the subject
+	constexpr void finish(const Position & position, bool at_begin) noexcept {
+		thread_list & from = lists[current];
+		thread_list & to = lists[current ^ 1];
+		to.count = 0;
+		++generation;
+		for (size_t i = 0; i < from.count; ++i) {
+			const pike_instruction & instruction = Program::code.code[from.pc[i]];
+			if (instruction.op == pike_op::match) {
+				add(to, from.pc[i], from.captures[i], position, at_begin, pike_end::yes);
+			} else if (instruction.op == pike_op::assert_end) {
+				add(to, from.pc[i] + 1, from.captures[i], position, at_begin, pike_end::yes);
+			}
+		}
+		for (size_t i = 0; i < to.count; ++i) {
+			if (Program::code.code[to.pc[i]].op == pike_op::match) {
+				best = to.captures[i];
+				matched = true;
+				break;
+			}
+		}
+		to.count = 0;
+		from.count = 0;
+	}
+};
+
+template <typename R, typename Captures, typename... Content, size_t... Idx> constexpr CTRE_FORCE_INLINE R pike_results(const Captures & captures, ctll::list<Content...>, std::index_sequence<Idx...>) noexcept {
+	R out{};
+	out.set_start_mark(captures.position[0]).set_end_mark(captures.position[1]);
+	((captures.set[2 + 2 * Idx] && captures.set[3 + 2 * Idx] ? (void)out.template start_capture<captured_id(Content{})>(captures.position[2 + 2 * Idx]).template end_capture<captured_id(Content{})>(captures.position[3 + 2 * Idx]) : (void)0), ...);
+	return out.matched();
+}
+
+template <typename R, typename Machine, typename Captures> constexpr CTRE_FORCE_INLINE R pike_output(const Machine & vm, Captures captures) noexcept {
+	if (!vm.matched) return R{};
+	return pike_results<R>(vm.best, captures, std::make_index_sequence<ctll::size(Captures{})>());
+}
+
+template <typename Pattern> constexpr bool pike_compatible(Pattern) noexcept {
+	return regular_compatible<true>(Pattern{});
+}
+
+template <typename Iterator, typename EndIterator, typename Pattern> 
+constexpr inline auto pike_match_re(const Iterator begin, const EndIterator end, Pattern pattern) noexcept {
+	static_assert(pike_compatible(Pattern{}), "Pike VM engine doesn't support back references, lookarounds and possessive repeats.");
+	using return_type = decltype(regex_results(std::declval<Iterator>(), find_captures(pattern)));
+	pike_machine<pike_program<Pattern, true>, Iterator> vm;
+
+	Iterator current = begin;
+	vm.start(current, true, (end == current) ? pike_end::yes : pike_end::no);
+	while (!vm.empty()) {
+		if (end == current) {
+			vm.finish(current, begin == current);
+			break;
+		}
+		const auto c = *current;
+		++current;
+		vm.step(c, current, (end == current) ? pike_end::yes : pike_end::no);
+	}
+	return pike_output<return_type>(vm, find_captures(pattern));
+}
+
+// `^` matches only at `begin`, threads start from `from` on
+template <typename Iterator, typename EndIterator, typename Pattern> 
+constexpr inline auto pike_search_re_from(const Iterator begin, const Iterator from, const EndIterator end, Pattern pattern) noexcept {
+	static_assert(pike_compatible(Pattern{}), "Pike VM engine doesn't support back references, lookarounds and possessive repeats.");
+	using return_type = decltype(regex_results(std::declval<Iterator>(), find_captures(pattern)));
+	pike_machine<pike_program<Pattern, false>, Iterator> vm;
+
+	Iterator current = from;
+	while (true) {
+		const pike_end at_end = (end == current) ? pike_end::yes : pike_end::no;
+		// leftmost match => no new threads after a match was found
+		if (!vm.matched) vm.start(current, begin == current, at_end);
+		if (at_end == pike_end::yes) {
+			vm.finish(current, begin == current);
+			break;
+		}
+		if (vm.empty() && vm.matched) break;
+		const auto c = *current;
+		++current;
+		vm.step(c, current, (end == current) ? pike_end::yes : pike_end::no);
+	}
+	return pike_output<return_type>(vm, find_captures(pattern));
+}
+
+template <typename Iterator, typename EndIterator, typename Pattern> 
+constexpr inline auto pike_search_re(const Iterator begin, const EndIterator end, Pattern pattern) noexcept {
+	return pike_search_re_from(begin, begin, end, pattern);
+}
+
+}
+
+#endif
+
+#ifndef CTRE__STREAM__HPP
+#define CTRE__STREAM__HPP
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <string>
+
+namespace ctre {
+
+// matches of a stream are reported as absolute offsets (there is no subject to view)
+template <> struct subject_units<size_t> {
+	using char_type = char;
+	
+	static constexpr CTRE_FORCE_INLINE size_t size(size_t begin, size_t end) noexcept {
+		return end - begin;
+	}
+};
+
+// search over a stream given in chunks: the Pike VM keeps its threads between them (with offsets instead of iterators)
+// and only characters which can still be searched again (after the end of a match) are kept
+template <typename Pattern, typename CharT = char> class stream_matcher {
+	static_assert(pike_compatible(Pattern{}), "Stream matcher doesn't support back references, lookarounds and possessive repeats.");
+	
+	using captures_list = decltype(find_captures(Pattern{}));
+	using machine = pike_machine<pike_program<Pattern, false>, size_t>;
+	using first_characters = decltype(calculate_first_characters(Pattern{}));
+	static constexpr size_t nowhere = std::numeric_limits<size_t>::max();
+	
+	machine vm{};
+	std::basic_string<CharT> buffer{}; // characters from `kept`
+	size_t kept{0};
+	size_t position{0}; // of the next character for the machine
+	size_t skip{nowhere}; // no new threads here (right after an empty match)
+	bool started{false}; // threads were already started at `position`
+	bool finished{false};
+	
+	template <typename Fn> void run(Fn & fn) {
+		const size_t available = kept + buffer.size();
+		const auto end_at = [&](size_t offset) {
+			return (offset != available) ? pike_end::no : (finished ? pike_end::yes : pike_end::unknown);
+		};
+		for (;;) {
+			// without threads the machine can skip to a character which can start a match
+			if constexpr (has_usable_first_characters(first_characters{})) {
+				if (!started && !vm.matched && vm.empty()) {
+					const CharT * current = buffer.data() + (position - kept);
+					find_first_character(current, buffer.data() + buffer.size(), first_characters{});
+					position = kept + static_cast<size_t>(current - buffer.data());
+				}
+			}
+			const pike_end at_end = end_at(position);
+			// leftmost match => no new threads after a match was found
+			if (!started && !vm.matched && position != skip) {
+				vm.start(position, position == 0, at_end);
+			}
+			started = true;
+			if (at_end == pike_end::yes) {
+				vm.finish(position, position == 0);
+				if (!vm.matched) return;
+			} else if (!vm.empty() || !vm.matched) {
+				if (position == available) return;
+				const CharT c = buffer[position - kept];
+				++position;
+				started = false;
+				vm.step(c, position, end_at(position));
+				continue;
+			}
+			// nothing can change the best match anymore, the search continues at its end
+			const size_t begin = vm.best.position[0];
+			const size_t end = vm.best.position[1];
+			fn(pike_output<result_type>(vm, captures_list{}));
+			vm = machine{};
+			position = end;
+			started = false;
+			skip = (begin == end) ? end : nowhere;
+		}
+	}
+	
+	// results are only offsets, so the characters already given to the machine are needed
+	// only behind the end of the best match (where the search continues once it's final)
+	void trim() {
+		const size_t keep = vm.matched ? std::min(position, vm.best.position[1]) : position;
+		buffer.erase(0, keep - kept);
+		kept = keep;
+	}
+	
+public:
+	using result_type = decltype(regex_results(std::declval<size_t>(), captures_list{}));
+	
+	// next part of the stream, fn(result) is called for every match which is already final
+	template <typename Chunk, typename Fn> void feed(const Chunk & chunk, Fn && fn) {
+		buffer.append(std::data(chunk), std::size(chunk));
+		run(fn);
+		trim();
+	}
+	
+	// end of the stream, the rest of the matches is reported and the matcher can be used for another stream
+	template <typename Fn> void finish(Fn && fn) {
+		finished = true;
+		run(fn);
+		*this = stream_matcher{};
+	}
+	
+	// characters kept for the matches in progress
+	size_t pending() const noexcept {
+		return buffer.size();
+	}
+};
+
+}
+
+#endif
+
+#ifndef CTRE__STEP_BUDGET__HPP
+#define CTRE__STEP_BUDGET__HPP
+
+#include <atomic>
+#include <cstddef>
+
+namespace ctre {
+
+// bounds the work of backtracking evaluation, once it's exhausted the evaluation stops and results say so
+class step_budget {
+	// the cancellation flag is checked only when a new chunk of steps is taken
+	static constexpr size_t chunk_size = 256;
+	size_t _remaining;
+	size_t _chunk{0};
+	const std::atomic<bool> * _cancel{nullptr};
+	bool _exhausted{false};
+	
+	constexpr bool refill() noexcept {
+		if (_exhausted || _remaining == 0 || (_cancel && _cancel->load(std::memory_order_relaxed))) {
+			_exhausted = true;
+			return false;
+		}
+		const size_t taken = (_remaining < chunk_size) ? _remaining : chunk_size;
+		_remaining -= taken;
+		_chunk = taken - 1;
+		return true;
+	}
+public:
+	constexpr explicit step_budget(size_t steps) noexcept: _remaining{steps} { }
+	constexpr step_budget(size_t steps, const std::atomic<bool> & cancel) noexcept: _remaining{steps}, _cancel{&cancel} { }
+	constexpr explicit step_budget(const std::atomic<bool> & cancel) noexcept: _remaining{static_cast<size_t>(-1)}, _cancel{&cancel} { }
+	
+	constexpr CTRE_FORCE_INLINE bool charge() noexcept {
+		if (_chunk != 0) {
+			--_chunk;
+			return true;
+		}
+		return refill();
+	}
+	constexpr bool exhausted() const noexcept {
+		return _exhausted;
+	}
+	constexpr size_t remaining() const noexcept {
+		return _remaining + _chunk;
+	}
+};
+
+// results of match/search with a budget, exhausted ones are not matched (a partial search can't tell the right answer)
+template <typename Results> class budgeted_results: public Results {
+	bool _exhausted;
+public:
+	constexpr CTRE_FORCE_INLINE budgeted_results(const Results & results, const step_budget & budget) noexcept: Results{budget.exhausted() ? Results{} : results}, _exhausted{budget.exhausted()} { }
+	
+	constexpr CTRE_FORCE_INLINE bool exhausted() const noexcept {
+		return _exhausted;
+	}
+};
+
+}
+
+#ifndef __EDG__
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wmismatched-tags"
+#endif
+
+namespace std {
+	template <typename Results> struct tuple_size<ctre::budgeted_results<Results>>: public tuple_size<Results> { };
+	
+	template <size_t N, typename Results> struct tuple_element<N, ctre::budgeted_results<Results>>: public tuple_element<N, Results> { };
+}
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+#endif
+
+#endif
+
+#ifndef CTRE__MEMOIZATION__HPP
+#define CTRE__MEMOIZATION__HPP
+
+#include <vector>
+
+// limit of memoized (repeat, iteration) states per one match/search, states above it are not memoized
+#ifndef CTRE_MEMO_MAX_STATES
+#define CTRE_MEMO_MAX_STATES 32
+#endif
+
+namespace ctre {
+
+// back references make the result depend on the captures and not only on the position
+template <typename T> constexpr bool uses_back_reference(T) noexcept { return false; }
+template <size_t Id> constexpr bool uses_back_reference(back_reference<Id>) noexcept { return true; }
+template <typename Id> constexpr bool uses_back_reference(back_reference_with_name<Id>) noexcept { return true; }
+template <template <typename...> typename Node, typename... Content> constexpr bool uses_back_reference(Node<Content...>) noexcept { return (false || ... || uses_back_reference(Content{})); }
+template <template <size_t, typename...> typename Node, size_t Id, typename... Content> constexpr bool uses_back_reference(Node<Id, Content...>) noexcept { return (false || ... || uses_back_reference(Content{})); }
+template <template <size_t, size_t, typename...> typename Node, size_t A, size_t B, typename... Content> constexpr bool uses_back_reference(Node<A, B, Content...>) noexcept { return (false || ... || uses_back_reference(Content{})); }
+template <size_t Id, typename Name, typename... Content> constexpr bool uses_back_reference(capture_with_name<Id, Name, Content...>) noexcept { return (false || ... || uses_back_reference(Content{})); }
+
+// every instantiated evaluation stack has its own address
+template <typename Stack> struct memo_key {
+	static constexpr char tag = 0;
+};
+
+// failed (stack, iteration, position) states, one bit per position of the subject
+template <typename Iterator> class backtracking_memo {
+	struct state_row {
+		const void * key;
+		size_t iteration;
+		std::vector<uint64_t> bits;
+	};
+	Iterator _begin;
+	state_row _rows[CTRE_MEMO_MAX_STATES]{};
+	size_t _used{0};
+public:
+	explicit backtracking_memo(Iterator begin) noexcept: _begin{begin} { }
+	
+	struct state {
+		std::vector<uint64_t> * bits;
+		size_t offset;
+		
+		bool failed() const noexcept {
+			return bits && (offset / 64) < bits->size() && ((*bits)[offset / 64] >> (offset % 64)) & 1u;
+		}
+		template <typename R> R result(R && r) const noexcept {
+			if (!r && bits) {
+				if ((offset / 64) >= bits->size()) bits->resize(offset / 64 + 1);
+				(*bits)[offset / 64] |= uint64_t{1} << (offset % 64);
+			}
+			return std::forward<R>(r);
+		}
+	};
+	
+	template <typename Stack> state find(size_t iteration, Iterator current) noexcept {
+		const void * key = &memo_key<Stack>::tag;
+		const auto offset = static_cast<size_t>(current - _begin);
+		for (size_t i = 0; i != _used; ++i) {
+			if (_rows[i].key == key && _rows[i].iteration == iteration) return {&_rows[i].bits, offset};
+		}
+		if (_used == CTRE_MEMO_MAX_STATES) return {nullptr, offset};
+		_rows[_used].key = key;
+		_rows[_used].iteration = iteration;
+		return {&_rows[_used++].bits, offset};
+	}
+};
+
+// results carrying the state of one evaluation (memo of failed states, step budget) through evaluate(), void = not used
+template <typename Results, typename Memo, typename Budget> class stateful_results: public Results {
+	Memo * _memo{nullptr};
+	Budget * _budget{nullptr};
+public:
+	constexpr CTRE_FORCE_INLINE stateful_results() noexcept { }
+	constexpr CTRE_FORCE_INLINE stateful_results(not_matched_tag_t) noexcept { }
+	constexpr CTRE_FORCE_INLINE stateful_results(Memo * memo, Budget * budget) noexcept: _memo{memo}, _budget{budget} { }
+	
+	constexpr CTRE_FORCE_INLINE Memo * memo() const noexcept {
+		return _memo;
+	}
+	constexpr CTRE_FORCE_INLINE Budget * budget() const noexcept {
+		return _budget;
+	}
+	constexpr CTRE_FORCE_INLINE stateful_results & matched() noexcept {
+		Results::matched();
+		return *this;
+	}
+	constexpr CTRE_FORCE_INLINE stateful_results & unmatch() noexcept {
+		Results::unmatch();
+		return *this;
+	}
+	template <typename Iterator> constexpr CTRE_FORCE_INLINE stateful_results & set_start_mark(Iterator pos) noexcept {
+		Results::set_start_mark(pos);
+		return *this;
+	}
+	template <typename Iterator> constexpr CTRE_FORCE_INLINE stateful_results & set_end_mark(Iterator pos) noexcept {
+		Results::set_end_mark(pos);
+		return *this;
+	}
+	template <size_t Id, typename Iterator> constexpr CTRE_FORCE_INLINE stateful_results & start_capture(Iterator pos) noexcept {
+		Results::template start_capture<Id>(pos);
+		return *this;
+	}
+	template <size_t Id, typename Iterator> constexpr CTRE_FORCE_INLINE stateful_results & end_capture(Iterator pos) noexcept {
+		Results::template end_capture<Id>(pos);
+		return *this;
+	}
+};
+
+// plain backtracking doesn't remember anything
+struct no_memo_state {
+	constexpr CTRE_FORCE_INLINE bool failed() const noexcept {
+		return false;
+	}
+	template <typename R> constexpr CTRE_FORCE_INLINE R result(R && r) const noexcept {
+		return std::forward<R>(r);
+	}
+};
+
+template <typename Stack, typename R, typename Iterator> constexpr CTRE_FORCE_INLINE auto memo_state(const R &, size_t, Iterator, Iterator) noexcept {
+	return no_memo_state{};
+}
+
+template <typename Stack, typename Results, typename Memo, typename Budget, typename Iterator> constexpr CTRE_FORCE_INLINE auto memo_state(const stateful_results<Results, Memo, Budget> & captures, size_t iteration, Iterator, Iterator current) noexcept {
+	if constexpr (std::is_void_v<Memo> || uses_back_reference(Stack{})) {
+		return no_memo_state{};
+	} else {
+		return captures.memo()->template find<Stack>(iteration, current);
+	}
+}
+
+// every repeat iteration, alternative and back reference costs one step of the budget
+template <typename R> constexpr CTRE_FORCE_INLINE bool charge_step(const R &) noexcept {
+	return true;
+}
+
+template <typename Results, typename Memo, typename Budget> constexpr CTRE_FORCE_INLINE bool charge_step(const stateful_results<Results, Memo, Budget> & captures) noexcept {
+	if constexpr (std::is_void_v<Budget>) {
+		return true;
+	} else {
+		return captures.budget()->charge();
+	}
+}
+
+// evaluation without any state (plain results)
+struct no_evaluation_state { };
+
+template <typename Results, typename State> using evaluation_results_t = std::conditional_t<std::is_same_v<State, no_evaluation_state>, Results, State>;
+
+// no point in trying other positions when the budget is gone
+template <typename R> constexpr CTRE_FORCE_INLINE bool evaluation_stopped(const R &) noexcept {
+	return false;
+}
+
+template <typename Results, typename Memo, typename Budget> constexpr CTRE_FORCE_INLINE bool evaluation_stopped(const stateful_results<Results, Memo, Budget> & captures) noexcept {
+	if constexpr (std::is_void_v<Budget>) {
+		return false;
+	} else {
+		return captures.budget()->exhausted();
+	}
+}
+
+}
+
+#endif
+
+// remove me when MSVC fix the constexpr bug
+#ifdef _MSC_VER
+#ifndef CTRE_MSVC_GREEDY_WORKAROUND
+#define CTRE_MSVC_GREEDY_WORKAROUND
+#endif
+#endif
+
+namespace ctre {
+
+// fresh results are spelled out at the start of the evaluation, the compiler folds their copies (unlike copies of an opaque value)
+template <typename R, typename Iterator, typename EndIterator, typename State, typename Stack>
+constexpr CTRE_FORCE_INLINE R evaluate_with(const Iterator begin, Iterator current, const EndIterator end, const State & state, Stack stack) noexcept {
+	if constexpr (std::is_same_v<State, no_evaluation_state>) {
+		return evaluate(begin, current, end, R{}, stack);
+	} else {
+		return evaluate(begin, current, end, state, stack);
+	}
+}
+
+// `.*X` (or `.*?X`) at the beginning of the pattern, full match only needs to find where X starts
+template <typename Pattern> struct leading_dot_star {
+	static constexpr bool value = false;
+};
+
+template <typename Head, typename... Rest> struct leading_dot_star<sequence<star<any>, Head, Rest...>> {
+	static constexpr bool value = true;
+	static constexpr bool greedy = true;
+	using rest = ctll::list<Head, Rest...>;
+};
+
+template <typename Head, typename... Rest> struct leading_dot_star<sequence<lazy_star<any>, Head, Rest...>> {
+	static constexpr bool value = true;
+	static constexpr bool greedy = false;
+	using rest = ctll::list<Head, Rest...>;
+};
+
+template <typename Iterator, typename EndIterator, typename Pattern> constexpr bool use_leading_dot_star() noexcept {
+	using info = leading_dot_star<Pattern>;
+	if constexpr (!info::value) {
+		return false;
+	} else if constexpr (!info::greedy || ctll::size(find_captures(Pattern{})) == 0) {
+		// the order of tried positions is the same as in backtracking (or it doesn't matter without captures)
+		return true;
+	} else {
+		// greedy `.*` tries the longest one first => positions from the end
+		return std::is_same_v<Iterator, EndIterator> && is_bidirectional_iterator_v<Iterator>;
+	}
+}
+
+template <typename R, bool Backward, typename Iterator, typename EndIterator, typename... Rest, typename State> 
+constexpr inline R match_after_dot_star(const Iterator begin, const EndIterator end, ctll::list<Rest...>, State state) noexcept {
+	using stack = ctll::list<Rest..., assert_end, end_mark, accept>;
+	constexpr auto first = calculate_first_characters(sequence<Rest...>{});
+	R captures{};
+	if constexpr (!std::is_same_v<State, no_evaluation_state>) {
+		captures = state;
+	}
+	captures.set_start_mark(begin);
+
+	if constexpr (Backward) {
+		Iterator it = end;
+		// X can still match empty at the end (`.*$`)
+		if (auto out = evaluate(begin, it, end, captures, stack())) {
+			return out;
+		} else if (evaluation_stopped(captures)) {
+			return R{};
+		}
+		while (it != begin) {
+			--it;
+			if constexpr (has_usable_first_characters(first)) {
+				if (!is_first_character(*it, first)) continue;
+			}
+			if (auto out = evaluate(begin, it, end, captures, stack())) {
+				return out;
+			} else if (evaluation_stopped(captures)) {
+				return R{};
+			}
+		}
+		return R{};
+	}
+
+	// the first position where X matches till the end is as good as any other
+	auto it = begin;
+	if constexpr (has_usable_first_characters(first)) {
+		for (; find_first_character(it, end, first); ++it) {
+			if (auto out = evaluate(begin, it, end, captures, stack())) {
+				return out;
+			} else if (evaluation_stopped(captures)) {
+				return R{};
+			}
+		}
+	} else {
+		for (; end != it; ++it) {
+			if (auto out = evaluate(begin, it, end, captures, stack())) {
+				return out;
+			} else if (evaluation_stopped(captures)) {
+				return R{};
+			}
+		}
+	}
+	return evaluate(begin, it, end, captures, stack());
+}
+
+// calling with pattern prepare stack and triplet of iterators
+// (a state can be carried through the evaluation in the results, see memoized_match_re and budgeted_match_re)
+template <typename Iterator, typename EndIterator, typename Pattern, typename State = no_evaluation_state> 
+constexpr inline auto match_re(const Iterator begin, const EndIterator end, Pattern pattern, State state = {}) noexcept {
+	using return_type = decltype(regex_results(std::declval<Iterator>(), find_captures(pattern)));
+	using R = evaluation_results_t<return_type, State>;
+	if constexpr (dfa_preferred<Iterator, Pattern>()) {
+		// linear, nothing to remember or bound
+		return return_type{dfa_match_re(begin, end, pattern)};
+	} else if constexpr (use_leading_dot_star<Iterator, EndIterator, Pattern>()) {
+		using info = leading_dot_star<Pattern>;
+		return match_after_dot_star<R, info::greedy && (ctll::size(find_captures(pattern)) > 0)>(begin, end, typename info::rest{}, state);
+	} else {
+		return evaluate_with<R>(begin, begin, end, state, ctll::list<start_mark, Pattern, assert_end, end_mark, accept>());
+	}
+}
+
+// search restarted at `from` inside a subject starting at `begin` (anchors still see where the subject begins)
+template <typename Iterator, typename EndIterator, typename Pattern, typename State = no_evaluation_state> 
+constexpr inline auto search_re_from(const Iterator begin, const Iterator from, const EndIterator end, Pattern pattern, State state = {}) noexcept {
+	using return_type = evaluation_results_t<decltype(regex_results(std::declval<Iterator>(), find_captures(pattern))), State>;
+
+	constexpr auto prefix = calculate_leading_string(pattern);
+	using factor = decltype(calculate_required_factor(pattern));
+
+	auto it = from;
+
+	if constexpr (decltype(strip_anchors(pattern))::begin) {
+		// every match starts at the beginning of the subject
+		if (begin != from) {
+			return return_type{};
+		}
+	}
+
+	if constexpr (line_anchored(Pattern{})) {
+		// multiline `^` => only beginnings of lines are tried,
+		// a match within a line also needs the required factor in it => lines before its next occurrence are skipped
+		constexpr bool skip_lines = use_required_factor_v<factor, string<>, Iterator, EndIterator> && !pattern_reach(Pattern{}).newline;
+		auto filter = make_required_factor_filter<factor, string<>>(from, end);
+		while (true) {
+			if constexpr (skip_lines) {
+				if (!filter.allows(it, end)) {
+					return return_type{};
+				}
+				if (filter.occurrence != it) {
+					auto line = filter.occurrence;
+					while (line != it && *(line - 1) != '\n') --line;
+					it = line;
+				}
+			}
+			if (auto out = evaluate_with<return_type>(begin, it, end, state, ctll::list<start_mark, Pattern, end_mark, accept>())) {
+				return out;
+			} else if (evaluation_stopped(state)) {
+				return return_type{};
+			}
+			if (!find_first_character(it, end, ctll::list<character<'\n'>>{})) {
+				return return_type{};
+			}
+			++it;
+		}
+	} else if constexpr (use_required_factor_v<factor, decltype(prefix), Iterator, EndIterator> && factor::offset != length_range::infinite) {
+		// every match has the required factor at the same distance from its start => only its occurrences are candidates
+		using difference_type = decltype(end - from);
+		constexpr auto offset = static_cast<difference_type>(factor::offset);
+		if (end - from < offset) {
+			return return_type{};
+		}
+		for (auto occurrence = from + offset; find_required_factor(occurrence, end, typename factor::string{}); ++occurrence) {
+			if (auto out = evaluate_with<return_type>(begin, occurrence - offset, end, state, ctll::list<start_mark, Pattern, end_mark, accept>())) {
+				return out;
+			} else if (evaluation_stopped(state)) {
+				return return_type{};
+			}
+		}
+		return return_type{};
+	} else {
+		// subject without the required factor can't match at all
+		auto filter = make_required_factor_filter<factor, decltype(prefix)>(from, end);
+
+		// only positions starting with the literal prefix can match (and an empty subject tail can't)
+		if constexpr (string_length(prefix) > 0) {
+			for (; find_leading_string(it, end, prefix); ++it) {
+				if (!filter.allows(it, end)) {
+					return return_type{};
+				}
+				if (auto out = evaluate_with<return_type>(begin, it, end, state, ctll::list<start_mark, Pattern, end_mark, accept>())) {
+					return out;
+				} else if (evaluation_stopped(state)) {
+					return return_type{};
+				}
+			}
+			return return_type{};
+		} else if constexpr (constexpr auto first = calculate_first_characters(pattern); has_usable_first_characters(first)) {
+			// skip characters which can't start a match
+			for (; find_first_character(it, end, first); ++it) {
+				if (!filter.allows(it, end)) {
+					return return_type{};
+				}
+				if (auto out = evaluate_with<return_type>(begin, it, end, state, ctll::list<start_mark, Pattern, end_mark, accept>())) {
+					return out;
+				} else if (evaluation_stopped(state)) {
+					return return_type{};
+				}
+			}
+			// RE still can match at the end (`a|$`)
+			return evaluate_with<return_type>(begin, it, end, state, ctll::list<start_mark, Pattern, end_mark, accept>());
+		} else {
+			for (; end != it; ++it) {
+				if (!filter.allows(it, end)) {
+					return return_type{};
+				}
+				if (auto out = evaluate_with<return_type>(begin, it, end, state, ctll::list<start_mark, Pattern, end_mark, accept>())) {
+					return out;
+				} else if (evaluation_stopped(state)) {
+					return return_type{};
+				}
+			}
+			
+			// in case the RE is empty
+			return evaluate_with<return_type>(begin, it, end, state, ctll::list<start_mark, Pattern, end_mark, accept>());
+		}
+	}
+}
+
+template <typename Iterator, typename EndIterator, typename Pattern, typename State = no_evaluation_state> 
+constexpr inline auto search_re(const Iterator begin, const EndIterator end, Pattern pattern, State state = {}) noexcept {
+	return search_re_from(begin, begin, end, pattern, state);
+}
+
+// the first non-empty match starting at `from` (replace retries it where it found an empty match, as std::regex_replace and PCRE)
+template <typename Iterator, typename EndIterator, typename Pattern> 
+constexpr inline auto non_empty_starts_with_re(const Iterator begin, const Iterator from, const EndIterator end, Pattern) noexcept {
+	using return_type = decltype(regex_results(std::declval<Iterator>(), find_captures(Pattern{})));
+	if constexpr (pattern_length(Pattern{}).max == 0) {
+		return return_type{};
+	} else {
+		return evaluate_with<return_type>(begin, from, end, no_evaluation_state{}, ctll::list<start_mark, Pattern, non_empty_end_mark, accept>());
+	}
+}
+
+// backtracking with a step budget, results after its exhaustion must be thrown away (see budgeted_results)
+template <typename Iterator, typename EndIterator, typename Pattern> 
+constexpr inline auto budgeted_match_re(const Iterator begin, const EndIterator end, Pattern pattern, step_budget & budget) noexcept {
+	using return_type = decltype(regex_results(std::declval<Iterator>(), find_captures(pattern)));
+	return return_type{match_re(begin, end, pattern, stateful_results<return_type, void, step_budget>{nullptr, &budget})};
+}
+
+template <typename Iterator, typename EndIterator, typename Pattern> 
+constexpr inline auto budgeted_search_re_from(const Iterator begin, const Iterator from, const EndIterator end, Pattern pattern, step_budget & budget) noexcept {
+	using return_type = decltype(regex_results(std::declval<Iterator>(), find_captures(pattern)));
+	return return_type{search_re_from(begin, from, end, pattern, stateful_results<return_type, void, step_budget>{nullptr, &budget})};
+}
+
+template <typename Iterator, typename EndIterator, typename Pattern> 
+constexpr inline auto budgeted_search_re(const Iterator begin, const EndIterator end, Pattern pattern, step_budget & budget) noexcept {
+	return budgeted_search_re_from(begin, begin, end, pattern, budget);
+}
+
+// backtracking which remembers failed states of greedy repeats, each of them is explored at most once per position
+template <typename Iterator, typename EndIterator, typename Pattern, typename Budget> 
+inline auto memoized_match_re_runtime(const Iterator begin, const EndIterator end, Pattern pattern, Budget * budget) noexcept {
+	using return_type = decltype(regex_results(std::declval<Iterator>(), find_captures(pattern)));
+	backtracking_memo<Iterator> memo{begin};
+	return return_type{match_re(begin, end, pattern, stateful_results<return_type, decltype(memo), Budget>{&memo, budget})};
+}
+
+template <typename Iterator, typename EndIterator, typename Pattern, typename Budget> 
+inline auto memoized_search_re_runtime(const Iterator begin, const Iterator from, const EndIterator end, Pattern pattern, Budget * budget) noexcept {
+	using return_type = decltype(regex_results(std::declval<Iterator>(), find_captures(pattern)));
+	// a failed state fails from any starting position => one memo for the whole search
+	backtracking_memo<Iterator> memo{from};
+	return return_type{search_re_from(begin, from, end, pattern, stateful_results<return_type, decltype(memo), Budget>{&memo, budget})};
+}
+
+template <typename Iterator, typename EndIterator, typename Pattern, typename Budget = void> 
+constexpr inline auto memoized_match_re(const Iterator begin, const EndIterator end, Pattern pattern, Budget * budget = nullptr) noexcept {
+	if constexpr (is_random_access_iterator_v<Iterator>) {
+		if (!CTRE_IS_CONSTANT_EVALUATED()) {
+			return memoized_match_re_runtime(begin, end, pattern, budget);
+		}
+	}
+	if constexpr (std::is_void_v<Budget>) {
+		return match_re(begin, end, pattern);
+	} else {
+		return budgeted_match_re(begin, end, pattern, *budget);
+	}
+}
+
+template <typename Iterator, typename EndIterator, typename Pattern, typename Budget = void> 
+constexpr inline auto memoized_search_re_from(const Iterator begin, const Iterator from, const EndIterator end, Pattern pattern, Budget * budget = nullptr) noexcept {
+	if constexpr (is_random_access_iterator_v<Iterator>) {
+		if (!CTRE_IS_CONSTANT_EVALUATED()) {
+			return memoized_search_re_runtime(begin, from, end, pattern, budget);
+		}
+	}
+	if constexpr (std::is_void_v<Budget>) {
+		return search_re_from(begin, from, end, pattern);
+	} else {
+		return budgeted_search_re_from(begin, from, end, pattern, *budget);
+	}
+}
+
+template <typename Iterator, typename EndIterator, typename Pattern, typename Budget = void> 
+constexpr inline auto memoized_search_re(const Iterator begin, const EndIterator end, Pattern pattern, Budget * budget = nullptr) noexcept {
+	return memoized_search_re_from(begin, begin, end, pattern, budget);
+}
+
+// sink for making the errors shorter
+template <typename R, typename Iterator, typename EndIterator> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator, Iterator, const EndIterator, R, ...) noexcept {
+	return R{};
+}
+
+// if we found "accept" object on stack => ACCEPT
+template <typename R, typename Iterator, typename EndIterator> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator, Iterator, const EndIterator, R captures, ctll::list<accept>) noexcept {
+	return captures.matched();
+}
+
+// if we found "reject" object on stack => REJECT
+template <typename R, typename... Rest, typename Iterator, typename EndIterator> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator, Iterator, const EndIterator, R, ctll::list<reject, Rest...>) noexcept {
+	return R{}; // just return not matched return type
+}
+
+// mark start of outer capture
+template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<start_mark, Tail...>) noexcept {
+	return evaluate(begin, current, end, captures.set_start_mark(current), ctll::list<Tail...>());
+}
+
+// mark end of outer capture
+template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<end_mark, Tail...>) noexcept {
+	return evaluate(begin, current, end, captures.set_end_mark(current), ctll::list<Tail...>());
+}
+
+// mark end of outer capture which isn't empty
+template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<non_empty_end_mark, Tail...>) noexcept {
+	if (captures.get_start_position() == current) {
+		return not_matched;
+	}
+	return evaluate(begin, current, end, captures.set_end_mark(current), ctll::list<Tail...>());
+}
+
+// mark end of cycle
+template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator, Iterator current, const EndIterator, R captures, ctll::list<end_cycle_mark>) noexcept {
+	return captures.set_end_mark(current).matched();
+}
+
+// matching everything which behave as a one character matcher
+
+// how many comparisons a class is checked with (classes with only one or two of them don't need a table)
+template <typename CharacterLike> constexpr size_t class_comparisons(CharacterLike) noexcept { return 3; }
+template <auto V> constexpr size_t class_comparisons(character<V>) noexcept { return 1; }
+template <auto A, auto B> constexpr size_t class_comparisons(char_range<A, B>) noexcept { return 1; }
+constexpr size_t class_comparisons(any) noexcept { return 0; }
+template <typename... Content> constexpr size_t class_comparisons(set<Content...>) noexcept { return (class_comparisons(Content{}) + ... + 0); }
+template <auto... Cs> constexpr size_t class_comparisons(enumeration<Cs...>) noexcept { return sizeof...(Cs); }
+template <typename... Content> constexpr size_t class_comparisons(negative_set<Content...>) noexcept { return (class_comparisons(Content{}) + ... + 0); }
+template <typename... Content> constexpr size_t class_comparisons(negate<Content...>) noexcept { return (class_comparisons(Content{}) + ... + 0); }
+
+// other classes over 1-byte characters are lowered into a 256-bit table at compile-time
+template <typename CharT, typename CharacterLike> struct byte_class_table {
+	static constexpr byte_set value = make_byte_set<CharT>(ctll::list<CharacterLike>{});
+};
+
+template <typename CharacterLike, typename CharT> constexpr CTRE_FORCE_INLINE bool match_character(CharT value) noexcept {
+	if constexpr (sizeof(CharT) == 1 && std::is_integral_v<CharT> && (class_comparisons(CharacterLike{}) > 2)) {
+		return byte_class_table<CharT, CharacterLike>::value.test(static_cast<unsigned char>(value));
+	} else {
+		return CharacterLike::match_char(value);
+	}
+}
+
+template <typename R, typename Iterator, typename EndIterator, typename CharacterLike, typename... Tail, typename = std::enable_if_t<(MatchesCharacter<CharacterLike>::template value<decltype(*std::declval<Iterator>())>)>>
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<CharacterLike, Tail...>) noexcept {
+	if (end == current) return not_matched;
+	if (!match_character<CharacterLike, std::remove_cv_t<std::remove_reference_t<decltype(*current)>>>(*current)) return not_matched;
+	return evaluate(begin, current+1, end, captures, ctll::list<Tail...>());
+}
+
+// matching strings in patterns
+
+template <typename Iterator> struct string_match_result {
+	Iterator current;
+	bool match;
+};
+
+template <auto Head, auto... String, typename Iterator, typename EndIterator> constexpr CTRE_FORCE_INLINE string_match_result<Iterator> evaluate_match_string(Iterator current, const EndIterator end) noexcept {
+	if ((end != current) && (Head == *current)) {
+		if constexpr (sizeof...(String) > 0) {
+			return evaluate_match_string<String...>(++current, end);
+		} else {
+			return {++current, true};
+		}
+	} else {
+		return {current, false}; // not needed but will optimize
+	}
+}
+
+// ASCII literals are compared with memcmp (compilers turn it into a few wide loads against packed constants)
+template <auto... String> static inline constexpr bool is_ascii_string_v = ((static_cast<int64_t>(String) >= 0 && static_cast<int64_t>(String) <= 127) && ... && true);
+
+template <typename R, typename Iterator, typename EndIterator, auto... String, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<string<String...>, Tail...>) noexcept {
+	if constexpr (sizeof...(String) > 1 && is_byte_pointer_v<Iterator> && std::is_same_v<Iterator, EndIterator> && is_ascii_string_v<String...>) {
+		if (!CTRE_IS_CONSTANT_EVALUATED()) {
+			constexpr auto length = sizeof...(String);
+			if (static_cast<size_t>(end - current) < length || std::memcmp(current, string_bytes<String...>::value, length) != 0) {
+				return not_matched;
+			}
+			return evaluate(begin, current + length, end, captures, ctll::list<Tail...>());
+		}
+	}
+	if constexpr (sizeof...(String) == 0) {
+		return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+	} else if (auto tmp = evaluate_match_string<String...>(current, end); tmp.match) {
+		return evaluate(begin, tmp.current, end, captures, ctll::list<Tail...>());
+	} else {
+		return not_matched;
+	}
+}
+
+// matching select in patterns
+template <typename R, typename Iterator, typename EndIterator, typename HeadOptions, typename... TailOptions, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<select<HeadOptions, TailOptions...>, Tail...>) noexcept {
+	if (!charge_step(captures)) {
+		return not_matched;
+	}
+	if (auto r = evaluate(begin, current, end, captures, ctll::list<HeadOptions, Tail...>())) {
+		return r;
+	} else {
+		return evaluate(begin, current, end, captures, ctll::list<select<TailOptions...>, Tail...>());
+	}
+}
+
+template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator, Iterator, const EndIterator, R, ctll::list<select<>, Tail...>) noexcept {
+	// no previous option was matched => REJECT
+	return not_matched;
+}
+
+// matching optional in patterns
+template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<optional<Content...>, Tail...>) noexcept {
+	if (!charge_step(captures)) {
+		return not_matched;
+	}
+	if (auto r1 = evaluate(begin, current, end, captures, ctll::list<sequence<Content...>, Tail...>())) {
+		return r1;
+	} else if (auto r2 = evaluate(begin, current, end, captures, ctll::list<Tail...>())) {
+		return r2;
+	} else {
+		return not_matched;
+	}
+}
+
+// lazy optional
+template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<lazy_optional<Content...>, Tail...>) noexcept {
+	if (!charge_step(captures)) {
+		return not_matched;
+	}
+	if (auto r1 = evaluate(begin, current, end, captures, ctll::list<Tail...>())) {
+		return r1;
+	} else if (auto r2 = evaluate(begin, current, end, captures, ctll::list<sequence<Content...>, Tail...>())) {
+		return r2;
+	} else {
+		return not_matched;
+	}
+}
+
+// leading fixed shape of a sequence is checked at once (if there is enough input to load it)
+template <typename R, typename Iterator, typename EndIterator, typename... Prefix, typename... Rest, typename... Tail>
+constexpr CTRE_FORCE_INLINE R evaluate_fixed_shape(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<Prefix...>, ctll::list<Rest...>, ctll::list<Tail...>) noexcept;
+
+// matching sequence in patterns
+template <typename R, typename Iterator, typename EndIterator, typename HeadContent, typename... TailContent, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<sequence<HeadContent, TailContent...>, Tail...>) noexcept {
+	if constexpr (has_fixed_shape_matcher_v<Iterator, EndIterator>) {
+		using split = decltype(split_fixed_shape(ctll::list<>{}, ctll::list<HeadContent, TailContent...>{}));
+		if constexpr (worth_fixed_shape(typename split::prefix{})) {
+			if (!CTRE_IS_CONSTANT_EVALUATED()) {
+				return evaluate_fixed_shape(begin, current, end, captures, typename split::prefix{}, typename split::rest{}, ctll::list<Tail...>());
+			}
+		}
+	}
+	if constexpr (sizeof...(TailContent) > 0) {
+		return evaluate(begin, current, end, captures, ctll::list<HeadContent, sequence<TailContent...>, Tail...>());
+	} else {
+		return evaluate(begin, current, end, captures, ctll::list<HeadContent, Tail...>());
+	}
+}
+
+template <typename R, typename Iterator, typename EndIterator, typename... Prefix, typename... Rest, typename... Tail>
+constexpr CTRE_FORCE_INLINE R evaluate_fixed_shape(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<Prefix...>, ctll::list<Rest...>, ctll::list<Tail...>) noexcept {
+	using shape = fixed_shape_of<std::remove_cv_t<std::remove_pointer_t<Iterator>>, Prefix...>;
+	if (static_cast<size_t>(end - current) < shape::value.available) {
+		return evaluate(begin, current, end, captures, ctll::list<Prefix..., Rest..., Tail...>());
+	}
+	if (!match_fixed_shape<shape::value>(reinterpret_cast<const unsigned char *>(current))) {
+		return not_matched;
+	}
+	fixed_shape_captures<0>(captures, current, ctll::list<Prefix...>{});
+	if constexpr (sizeof...(Rest) > 0) {
+		return evaluate(begin, current + shape::width, end, captures, ctll::list<sequence<Rest...>, Tail...>());
+	} else {
+		return evaluate(begin, current + shape::width, end, captures, ctll::list<Tail...>());
+	}
+}
+
+// matching empty in patterns
+template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<empty, Tail...>) noexcept {
+	return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+}
+
+// matching asserts
+template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<assert_begin, Tail...>) noexcept {
+	if (begin != current) {
+		return not_matched;
+	}
+	return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+}
+
+template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<assert_end, Tail...>) noexcept {
+	if (end != current) {
+		return not_matched;
+	}
+	return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+}
+
+template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<assert_line_begin, Tail...>) noexcept {
+	static_assert(is_bidirectional_iterator_v<Iterator>, "Multiline `^` needs to look at the previous character (bidirectional iterator).");
+	if (begin != current && *std::prev(current) != '\n') {
+		return not_matched;
+	}
+	return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+}
+
+template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<assert_line_end, Tail...>) noexcept {
+	if (end != current && *current != '\n') {
+		return not_matched;
+	}
+	return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+}
+
+// lazy repeat
+template <typename R, typename Iterator, typename EndIterator, size_t A, size_t B, typename... Content, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<lazy_repeat<A,B,Content...>, Tail...>) noexcept {
+	// A..B
+	size_t i{0};
+	for (; i < A && (A != 0); ++i) {
+		if (auto outer_result = evaluate(begin, current, end, captures, ctll::list<sequence<Content...>, end_cycle_mark>())) {
+			captures = outer_result.unmatch();
+			current = outer_result.get_end_position();
+		} else {
+			return not_matched;
+		}
+	}
+	
+	if (auto outer_result = evaluate(begin, current, end, captures, ctll::list<Tail...>())) {
+		return outer_result;
+	} else {
+		for (; (i < B) || (B == 0); ++i) {
+			if (!charge_step(captures)) {
+				return not_matched;
+			}
+			if (auto inner_result = evaluate(begin, current, end, captures, ctll::list<sequence<Content...>, end_cycle_mark>())) {
+				if (auto outer_result = evaluate(begin, inner_result.get_end_position(), end, inner_result.unmatch(), ctll::list<Tail...>())) {
+					return outer_result;
+				} else {
+					captures = inner_result.unmatch();
+					current = inner_result.get_end_position();
+					continue;
+				}
+			} else {
+				return not_matched;
+			}
+		}
+		return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+	}
+}
+
+// possessive repeat
+template <typename R, typename Iterator, typename EndIterator, size_t A, size_t B, typename... Content, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<possessive_repeat<A,B,Content...>, Tail...>) noexcept {
+
+	for (size_t i{0}; (i < B) || (B == 0); ++i) {
+		if (!charge_step(captures)) {
+			return not_matched;
+		}
+		// try as many of inner as possible and then try outer once
+		if (auto inner_result = evaluate(begin, current, end, captures, ctll::list<sequence<Content...>, end_cycle_mark>())) {
+			captures = inner_result.unmatch();
+			current = inner_result.get_end_position();
+		} else {
+			if (i < A && (A != 0)) return not_matched;
+			else return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+		}
+	}
+	
+	return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+}
+
+// possessive repeat of any character (`.*` before the end) only needs to count characters
+template <typename R, typename Iterator, typename EndIterator, size_t A, size_t B, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<possessive_repeat<A,B,any>, Tail...>) noexcept {
+	if constexpr (std::is_same_v<Iterator, EndIterator> && is_random_access_iterator_v<Iterator>) {
+		const auto available = static_cast<size_t>(end - current);
+		if (available < A) return not_matched;
+		current += static_cast<decltype(end - current)>((B == 0 || available <= B) ? available : B);
+	} else {
+		size_t i{0};
+		for (; ((i < B) || (B == 0)) && end != current; ++i) {
+			++current;
+		}
+		if (i < A) return not_matched;
+	}
+	return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+}
+
+// end of a run of bytes from the class is the first byte from its complement
+template <typename CharT, typename CharacterLike> struct run_end_scanner {
+	static constexpr byte_scanner value = byte_scanner(byte_class_table<CharT, CharacterLike>::value.complement());
+};
+
+// possessive repeat of one character class (`\d+`, `[^ ]*`) only needs to find end of the run (the whole run is one step)
+template <typename R, typename Iterator, typename EndIterator, size_t A, size_t B, typename CharacterLike, typename... Tail, typename = std::enable_if_t<(MatchesCharacter<CharacterLike>::template value<decltype(*std::declval<Iterator>())>) && !std::is_same_v<CharacterLike, any>>>
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<possessive_repeat<A,B,CharacterLike>, Tail...>) noexcept {
+	using char_type = std::remove_cv_t<std::remove_reference_t<decltype(*current)>>;
+	if (!charge_step(captures)) {
+		return not_matched;
+	}
+	// short bounded runs are faster without the vector setup
+	if constexpr (is_byte_pointer_v<Iterator> && std::is_same_v<Iterator, EndIterator> && (B == 0 || B >= 16)) {
+		if (!CTRE_IS_CONSTANT_EVALUATED()) {
+			const auto * data = reinterpret_cast<const unsigned char *>(current);
+			const auto * limit = reinterpret_cast<const unsigned char *>((B == 0 || static_cast<size_t>(end - current) <= B) ? end : current + B);
+			const auto length = scan_bytes<run_end_scanner<char_type, CharacterLike>::value>(data, limit) - data;
+			if (static_cast<size_t>(length) < A) return not_matched;
+			return evaluate(begin, current + length, end, captures, ctll::list<Tail...>());
+		}
+	}
+	size_t i{0};
+	for (; ((i < B) || (B == 0)) && end != current && match_character<CharacterLike, char_type>(*current); ++i) {
+		++current;
+	}
+	if (i < A) return not_matched;
+	return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+}
+
+// (gready) repeat
+template <typename R, typename Iterator, typename EndIterator, size_t A, size_t B, typename... Content, typename... Tail> 
+#ifdef CTRE_MSVC_GREEDY_WORKAROUND
+constexpr inline void evaluate_recursive(R & result, size_t i, const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<repeat<A,B,Content...>, Tail...> stack) {
+#else
+constexpr inline R evaluate_recursive(size_t i, const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<repeat<A,B,Content...>, Tail...> stack) {
+#endif
+	// with memoization a state which already failed is not explored again (the iteration only matters for bounded repeats)
+	[[maybe_unused]] const auto memo = memo_state<decltype(stack)>(captures, (B == 0) ? 0 : i, begin, current);
+	if (memo.failed() || !charge_step(captures)) {
+		#ifdef CTRE_MSVC_GREEDY_WORKAROUND
+		result = not_matched;
+		return;
+		#else
+		return not_matched;
+		#endif
+	}
+	
+	if ((B == 0) || (i < B)) {
+		 
+		// a*ab
+		// aab
+		
+		if (auto inner_result = evaluate(begin, current, end, captures, ctll::list<sequence<Content...>, end_cycle_mark>())) {
+			// TODO MSVC issue:
+			// if I uncomment this return it will not fail in constexpr (but the matching result will not be correct)
+			//  return inner_result
+			// I tried to add all constructors to R but without any success 
+			#ifdef CTRE_MSVC_GREEDY_WORKAROUND
+			evaluate_recursive(result, i+1, begin, inner_result.get_end_position(), end, inner_result.unmatch(), stack);
+			if (result) {
+				return;
+			}
+			#else
+			if (auto rec_result = evaluate_recursive(i+1, begin, inner_result.get_end_position(), end, inner_result.unmatch(), stack)) {
+				return rec_result;
+			}
+			#endif
+		}
+	} 
+	#ifdef CTRE_MSVC_GREEDY_WORKAROUND
+	result = memo.result(evaluate(begin, current, end, captures, ctll::list<Tail...>()));
+	#else
+	return memo.result(evaluate(begin, current, end, captures, ctll::list<Tail...>()));
+	#endif
+}	
+
+// (gready) repeat optimization
+// basic one, if you are at the end of RE, just change it into possessive
+// TODO do the same if there is no collision with rest of the RE
+template <typename R, typename Iterator, typename EndIterator, size_t A, size_t B, typename... Content, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<repeat<A,B,Content...>,assert_end, Tail...>) {
+	return evaluate(begin, current, end, captures, ctll::list<possessive_repeat<A,B,Content...>, assert_end, Tail...>());
+}
+
+template <typename... T> struct identify_type;
+
+// (greedy) repeat 
+template <typename R, typename Iterator, typename EndIterator, size_t A, size_t B, typename... Content, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, [[maybe_unused]] ctll::list<repeat<A,B,Content...>, Tail...> stack) {
+	// check if it can be optimized
+#ifndef CTRE_DISABLE_GREEDY_OPT
+	if constexpr (collides(calculate_first(Content{}...), calculate_first(Tail{}...))) {
+#endif
+		// A..B
+		size_t i{0};
+		for (; i < A && (A != 0); ++i) {
+			if (auto inner_result = evaluate(begin, current, end, captures, ctll::list<sequence<Content...>, end_cycle_mark>())) {
+				captures = inner_result.unmatch();
+				current = inner_result.get_end_position();
+			} else {
+				return not_matched;
+			}
+		}
+	#ifdef CTRE_MSVC_GREEDY_WORKAROUND
+		R result;
+		evaluate_recursive(result, i, begin, current, end, captures, stack);
+		return result;
+	#else
+		return evaluate_recursive(i, begin, current, end, captures, stack);
+	#endif
+#ifndef CTRE_DISABLE_GREEDY_OPT
+	} else {
+		// if there is no collision we can go possessive
+		return evaluate(begin, current, end, captures, ctll::list<possessive_repeat<A,B,Content...>, Tail...>());
+	}
+#endif
+
+}
+
+// repeat lazy_star
+template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<lazy_star<Content...>, Tail...>) noexcept {
+	return evaluate(begin, current, end, captures, ctll::list<lazy_repeat<0,0,Content...>, Tail...>());
+}
+
+// repeat (lazy_plus)
+template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<lazy_plus<Content...>, Tail...>) noexcept {
+	return evaluate(begin, current, end, captures, ctll::list<lazy_repeat<1,0,Content...>, Tail...>());
+}
+
+// repeat (possessive_star)
+template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<possessive_star<Content...>, Tail...>) noexcept {
+	return evaluate(begin, current, end, captures, ctll::list<possessive_repeat<0,0,Content...>, Tail...>());
+}
+
+// repeat (possessive_plus)
+template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<possessive_plus<Content...>, Tail...>) noexcept {
+	return evaluate(begin, current, end, captures, ctll::list<possessive_repeat<1,0,Content...>, Tail...>());
+}
+
+// repeat (greedy) star
+template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<star<Content...>, Tail...>) noexcept {
+	return evaluate(begin, current, end, captures, ctll::list<repeat<0,0,Content...>, Tail...>());
+}
+
+// repeat (greedy) plus
+template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<plus<Content...>, Tail...>) noexcept {
+	return evaluate(begin, current, end, captures, ctll::list<repeat<1,0,Content...>, Tail...>());
+}
+
+// capture (numeric ID)
+template <typename R, typename Iterator, typename EndIterator, size_t Id, typename... Content, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<capture<Id, Content...>, Tail...>) noexcept {
+	return evaluate(begin, current, end, captures.template start_capture<Id>(current), ctll::list<sequence<Content...>, numeric_mark<Id>, Tail...>());
+}
+
+// capture end mark (numeric and string ID)
+template <typename R, typename Iterator, typename EndIterator, size_t Id, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<numeric_mark<Id>, Tail...>) noexcept {
+	return evaluate(begin, current, end, captures.template end_capture<Id>(current), ctll::list<Tail...>());
+}
+
+// capture (string ID)
+template <typename R, typename Iterator, typename EndIterator, size_t Id, typename Name, typename... Content, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<capture_with_name<Id, Name, Content...>, Tail...>) noexcept {
+	return evaluate(begin, current, end, captures.template start_capture<Id>(current), ctll::list<sequence<Content...>, numeric_mark<Id>, Tail...>());
+}
+
+// backreference support (match agains content of iterators)
+template <typename Iterator, typename EndIterator> constexpr CTRE_FORCE_INLINE string_match_result<Iterator> match_against_range(Iterator current, const EndIterator end, Iterator range_current, const Iterator range_end) noexcept {
+	// captured content on byte pointers is compared at once
+	if constexpr (is_byte_pointer_v<Iterator> && std::is_same_v<Iterator, EndIterator>) {
+		if (!CTRE_IS_CONSTANT_EVALUATED()) {
+			const auto length = range_end - range_current;
+			if (end - current < length || std::memcmp(current, range_current, static_cast<size_t>(length)) != 0) {
+				return {current, false};
+			}
+			return {current + length, true};
+		}
+	}
+	while (end != current && range_end != range_current) {
+		if (*current == *range_current) {
+			current++;
+			range_current++;
+		} else {
+			return {current, false};
+		}
+	}
+	return {current, range_current == range_end};
+}
+
+// backreference with name
+template <typename R, typename Id, typename Iterator, typename EndIterator, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<back_reference_with_name<Id>, Tail...>) noexcept {
+	if (!charge_step(captures)) {
+		return not_matched;
+	}
+	if (const auto ref = captures.template get<Id>()) {
+		if (auto tmp = match_against_range(current, end, ref.begin(), ref.end()); tmp.match) {
+			return evaluate(begin, tmp.current, end, captures, ctll::list<Tail...>());
+		}
+	}
+	return not_matched;
+}
+
+// backreference
+template <typename R, size_t Id, typename Iterator, typename EndIterator, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<back_reference<Id>, Tail...>) noexcept {
+	if (!charge_step(captures)) {
+		return not_matched;
+	}
+	if (const auto ref = captures.template get<Id>()) {
+		if (auto tmp = match_against_range(current, end, ref.begin(), ref.end()); tmp.match) {
+			return evaluate(begin, tmp.current, end, captures, ctll::list<Tail...>());
+		}
+	}
+	return not_matched;
+}
+
+// end of lookahead
+template <typename R, typename Iterator, typename EndIterator, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator, Iterator, const EndIterator, R captures, ctll::list<end_lookahead_mark>) noexcept {
+	return captures.matched();
+}
+
+// lookahead positive
+template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<lookahead_positive<Content...>, Tail...>) noexcept {
+	
+	if (auto lookahead_result = evaluate(begin, current, end, captures, ctll::list<sequence<Content...>, end_lookahead_mark>())) {
+		captures = lookahead_result.unmatch();
+		return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+	} else {
+		return not_matched;
+	}
+}
+
+// lookahead negative
+template <typename R, typename Iterator, typename EndIterator, typename... Content, typename... Tail> 
+constexpr CTRE_FORCE_INLINE R evaluate(const Iterator begin, Iterator current, const EndIterator end, R captures, ctll::list<lookahead_negative<Content...>, Tail...>) noexcept {
+	
+	if (auto lookahead_result = evaluate(begin, current, end, captures, ctll::list<sequence<Content...>, end_lookahead_mark>())) {
+		return not_matched;
+	} else {
+		return evaluate(begin, current, end, captures, ctll::list<Tail...>());
+	}
+}
+
+// property matching
+// properties are matched as characters (category_property::match_char), bytes through the tables of match_character
+
+}
+
+#endif
+
+#ifndef CTRE__ENGINES__HPP
+#define CTRE__ENGINES__HPP
+
+#include <type_traits>
+
+namespace ctre {
+
+// engines selectable with ctre::match<pattern, Engine> / ctre::search<pattern, Engine>
+struct engine_tag {
+	// engines with linear time ignore step budgets
+	static constexpr bool budgeted = false;
+};
+
+// default (the DFA is used automatically when it gives the same result)
+struct backtracking: engine_tag {
+	static constexpr bool budgeted = true;
+	
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto match(Iterator begin, EndIterator end, Pattern pattern) noexcept {
+		return match_re(begin, end, pattern);
+	}
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto search(Iterator begin, EndIterator end, Pattern pattern) noexcept {
+		return search_re(begin, end, pattern);
+	}
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto match(Iterator begin, EndIterator end, Pattern pattern, step_budget & budget) noexcept {
+		return budgeted_match_re(begin, end, pattern, budget);
+	}
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto search(Iterator begin, EndIterator end, Pattern pattern, step_budget & budget) noexcept {
+		return budgeted_search_re(begin, end, pattern, budget);
+	}
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto search_from(Iterator begin, Iterator from, EndIterator end, Pattern pattern) noexcept {
+		return search_re_from(begin, from, end, pattern);
+	}
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto search_from(Iterator begin, Iterator from, EndIterator end, Pattern pattern, step_budget & budget) noexcept {
+		return budgeted_search_re_from(begin, from, end, pattern, budget);
+	}
+};
+
+// same results as backtracking, failed states of greedy repeats are remembered so each of them is explored once per position
+struct memoized_backtracking: engine_tag {
+	static constexpr bool budgeted = true;
+	
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto match(Iterator begin, EndIterator end, Pattern pattern) noexcept {
+		return memoized_match_re(begin, end, pattern);
+	}
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto search(Iterator begin, EndIterator end, Pattern pattern) noexcept {
+		return memoized_search_re(begin, end, pattern);
+	}
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto match(Iterator begin, EndIterator end, Pattern pattern, step_budget & budget) noexcept {
+		return memoized_match_re(begin, end, pattern, &budget);
+	}
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto search(Iterator begin, EndIterator end, Pattern pattern, step_budget & budget) noexcept {
+		return memoized_search_re(begin, end, pattern, &budget);
+	}
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto search_from(Iterator begin, Iterator from, EndIterator end, Pattern pattern) noexcept {
+		return memoized_search_re_from(begin, from, end, pattern);
+	}
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto search_from(Iterator begin, Iterator from, EndIterator end, Pattern pattern, step_budget & budget) noexcept {
+		return memoized_search_re_from(begin, from, end, pattern, &budget);
+	}
+};
+
+// linear time with captures and leftmost-first results, only for patterns without back references, lookarounds and possessive repeats
+struct pike_vm: engine_tag {
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto match(Iterator begin, EndIterator end, Pattern pattern) noexcept {
+		return pike_match_re(begin, end, pattern);
+	}
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto search(Iterator begin, EndIterator end, Pattern pattern) noexcept {
+		return pike_search_re(begin, end, pattern);
+	}
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto search_from(Iterator begin, Iterator from, EndIterator end, Pattern pattern) noexcept {
+		return pike_search_re_from(begin, from, end, pattern);
+	}
+};
+
+// linear time, only for regular patterns, doesn't provide captures and search finds the leftmost-longest match
+struct dfa: engine_tag {
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto match(Iterator begin, EndIterator end, Pattern pattern) noexcept {
+		return dfa_match_re(begin, end, pattern);
+	}
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto search(Iterator begin, EndIterator end, Pattern pattern) noexcept {
+		return dfa_search_re(begin, end, pattern);
+	}
+	// the only `^` it supports starts the pattern
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto search_from(Iterator begin, Iterator from, EndIterator end, Pattern pattern) noexcept {
+		if constexpr (decltype(strip_anchors(pattern))::begin) {
+			if (begin != from) return decltype(dfa_search_re(from, end, pattern)){};
+		}
+		return dfa_search_re(from, end, pattern);
+	}
+};
+
+// deterministic matching with captures (same as backtracking) for one-pass patterns, search is backtracking
+// (opt-in: linear and without recursion over the subject, it pays off on long subjects, the backtracking is faster on short ones)
+struct one_pass: engine_tag {
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto match(Iterator begin, EndIterator end, Pattern pattern) noexcept {
+		return one_pass_match_re(begin, end, pattern);
+	}
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto search(Iterator begin, EndIterator end, Pattern pattern) noexcept {
+		return search_re(begin, end, pattern);
+	}
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto search_from(Iterator begin, Iterator from, EndIterator end, Pattern pattern) noexcept {
+		return search_re_from(begin, from, end, pattern);
+	}
+};
+
+// same as dfa, but its states are built at run time into a bounded per-thread cache (for patterns with too many states)
+struct lazy_dfa: engine_tag {
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto match(Iterator begin, EndIterator end, Pattern pattern) noexcept {
+		return lazy_dfa_match_re(begin, end, pattern);
+	}
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto search(Iterator begin, EndIterator end, Pattern pattern) noexcept {
+		return lazy_dfa_search_re(begin, end, pattern);
+	}
+	template <typename Iterator, typename EndIterator, typename Pattern> static constexpr CTRE_FORCE_INLINE auto search_from(Iterator begin, Iterator from, EndIterator end, Pattern pattern) noexcept {
+		if constexpr (decltype(strip_anchors(pattern))::begin) {
+			if (begin != from) return decltype(lazy_dfa_search_re(from, end, pattern)){};
+		}
+		return lazy_dfa_search_re(from, end, pattern);
+	}
+};
+
+// the last engine in modifiers wins
+template <typename Engine, typename... Modifiers> struct select_engine {
+	using type = Engine;
+};
+
+template <typename Engine, typename Head, typename... Tail> struct select_engine<Engine, Head, Tail...>: select_engine<std::conditional_t<std::is_base_of_v<engine_tag, Head>, Head, Engine>, Tail...> { };
+
+template <typename... Modifiers> using engine_t = typename select_engine<backtracking, Modifiers...>::type;
+
+}
+
+#endif
+
+#ifndef CTRE__REGEX_SET__HPP
+#define CTRE__REGEX_SET__HPP
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace ctre {
+
+// which patterns of a set matched
+template <size_t N> struct regex_set_results {
+	position_set<(N + 63) / 64> bits{};
+
+	static constexpr size_t size() noexcept {
+		return N;
+	}
+	constexpr void set(size_t i) noexcept {
+		bits.insert(i);
+	}
+	constexpr bool test(size_t i) const noexcept {
+		return bits.test(i);
+	}
+	constexpr size_t count() const noexcept {
+		return bits.count();
+	}
+	constexpr bool any() const noexcept {
+		return !bits.empty();
+	}
+	constexpr bool none() const noexcept {
+		return bits.empty();
+	}
+	constexpr bool all() const noexcept {
+		return count() == N;
+	}
+	constexpr explicit operator bool() const noexcept {
+		return any();
+	}
+	constexpr bool operator==(const regex_set_results & rhs) const noexcept {
+		return bits == rhs.bits;
+	}
+	constexpr bool operator!=(const regex_set_results & rhs) const noexcept {
+		return bits != rhs.bits;
+	}
+};
+
+// patterns which can be part of the common automaton, the rest is evaluated one by one
+template <typename CharT, typename Pattern> constexpr bool regex_set_member() noexcept {
+	if constexpr (is_dfa_character_v<CharT>) {
+		return regular_compatible<false>(typename decltype(strip_anchors(Pattern{}))::type{});
+	} else {
+		return false;
+	}
+}
+
+template <typename CharT, typename Pattern> constexpr size_t regex_set_positions() noexcept {
+	if constexpr (regex_set_member<CharT, Pattern>()) {
+		return glushkov_positions(typename decltype(strip_anchors(Pattern{}))::type{});
+	} else {
+		return 0;
+	}
+}
+
+// union of Glushkov automata of all members, every pattern knows its own accepting positions
+template <size_t Positions, size_t Patterns> struct regex_set_nfa {
+	using nfa_type = glushkov_nfa<Positions>;
+	using set_type = typename nfa_type::set_type;
+
+	nfa_type nfa{};
+	bool member[Patterns]{};
+	set_type accepting[Patterns]{};
+	// pattern ends with `$` (or whole subject must match)
+	bool at_end[Patterns]{};
+	regex_set_results<Patterns> members{};
+	// pattern of every position
+	size_t owner[nfa_type::size]{};
+	// patterns matching an empty string: anywhere, at the end, or only an empty subject
+	regex_set_results<Patterns> empty_now{};
+	regex_set_results<Patterns> empty_at_end{};
+	regex_set_results<Patterns> empty_subject{};
+};
+
+template <typename CharT, bool Whole, size_t Index, typename Pattern, typename Out> constexpr void add_regex_set_member(Out & out) noexcept {
+	if constexpr (regex_set_member<CharT, Pattern>()) {
+		using anchored = decltype(strip_anchors(Pattern{}));
+		using nfa_type = typename Out::nfa_type;
+		const size_t from = out.nfa.used;
+		const auto top = glushkov<CharT>(out.nfa, typename anchored::type{});
+		const bool begin = Whole || anchored::begin;
+		const bool end = Whole || anchored::end;
+		for (size_t p = from; p < out.nfa.used; ++p) {
+			out.owner[p] = Index;
+		}
+
+		// the non-looping start is the initial state, so it also starts the unanchored patterns
+		out.nfa.follow[nfa_type::start_once] |= top.first;
+		if (!begin) out.nfa.follow[nfa_type::start_loop] |= top.first;
+
+		out.member[Index] = true;
+		out.members.set(Index);
+		out.accepting[Index] = top.last;
+		if (top.nullable) {
+			out.accepting[Index].insert(nfa_type::start_once);
+			if (!begin) out.accepting[Index].insert(nfa_type::start_loop);
+
+			if (!end) out.empty_now.set(Index);
+			else if (!begin) out.empty_at_end.set(Index);
+			else out.empty_subject.set(Index);
+		}
+		out.at_end[Index] = end;
+		out.nfa.accepting |= out.accepting[Index];
+
+		// only existence of a match matters => nothing after its end is needed (keeps the automaton small)
+		if (!end) {
+			for (size_t p = from; p < out.nfa.used; ++p) {
+				if (top.last.test(p)) out.nfa.follow[p] = typename nfa_type::set_type{};
+			}
+		}
+	}
+}
+
+template <typename CharT, bool Whole, typename... Patterns, size_t... Idx> constexpr auto build_regex_set_nfa(std::index_sequence<Idx...>) noexcept {
+	constexpr size_t positions = (regex_set_positions<CharT, Patterns>() + ... + 0);
+	regex_set_nfa<positions, sizeof...(Patterns)> out;
+	(add_regex_set_member<CharT, Whole, Idx, Patterns>(out), ...);
+
+	using nfa_type = glushkov_nfa<positions>;
+	out.nfa.symbols[nfa_type::start_loop] = byte_set{}.complement();
+	out.nfa.follow[nfa_type::start_loop].insert(nfa_type::start_loop);
+	if (!Whole) out.nfa.follow[nfa_type::start_once].insert(nfa_type::start_loop);
+	return out;
+}
+
+// patterns accepting in every state of the DFA (indexed by row), separately for the end of the subject
+template <size_t States, size_t Patterns> struct regex_set_masks {
+	regex_set_results<Patterns> now[States]{};
+	regex_set_results<Patterns> at_end[States]{};
+};
+
+template <size_t States, size_t Patterns, typename Builder, typename Set> constexpr auto make_regex_set_masks(const Builder & builder, const Set & set) noexcept {
+	regex_set_masks<States, Patterns> out;
+	const auto order = make_dfa_state_order<States>(builder);
+	for (size_t i = 0; i < States; ++i) {
+		for (size_t j = 0; j < Patterns; ++j) {
+			if (!set.member[j] || !builder.sets[i].intersects(set.accepting[j])) continue;
+			out.at_end[order.of[i]].set(j);
+			if (!set.at_end[j]) out.now[order.of[i]].set(j);
+		}
+	}
+	return out;
+}
+
+template <bool Build, size_t Classes, typename NFA> constexpr auto make_regex_set_builder(const NFA & nfa, const dfa_byte_classes & classes) noexcept {
+	if constexpr (Build) {
+		return build_dfa<Classes, CTRE_DFA_MAX_STATES>(nfa, classes);
+	} else {
+		dfa_builder<NFA, 1, 1> out;
+		out.overflow = true;
+		return out;
+	}
+}
+
+template <bool Fits, size_t States, size_t Patterns, typename Builder, typename Set> constexpr auto make_regex_set_masks_if(const Builder & builder, const Set & set) noexcept {
+	if constexpr (Fits) {
+		return make_regex_set_masks<States, Patterns>(builder, set);
+	} else {
+		return regex_set_masks<1, Patterns>{};
+	}
+}
+
+template <typename CharT, bool Whole, typename... Patterns> struct regex_set_automaton {
+	static constexpr size_t patterns = sizeof...(Patterns);
+	static constexpr auto set = build_regex_set_nfa<CharT, Whole, Patterns...>(std::make_index_sequence<patterns>());
+	static constexpr bool empty = set.members.none();
+
+	// DFA if it's small enough, otherwise the NFA is simulated with bitsets
+	static constexpr bool try_dfa = decltype(set.nfa)::positions <= CTRE_DFA_MAX_POSITIONS;
+	static constexpr auto classes = make_dfa_byte_classes(set.nfa);
+	static constexpr auto builder = make_regex_set_builder<try_dfa, classes.count>(set.nfa, classes);
+	static constexpr bool fits = !builder.overflow;
+	static constexpr auto table = make_dfa_table<fits, builder.states, classes.count>(builder, classes);
+	static constexpr auto masks = make_regex_set_masks_if<fits, builder.states, patterns>(builder, set);
+};
+
+template <typename Automaton, typename Iterator, typename EndIterator> 
+constexpr inline void regex_set_dfa(const Iterator begin, const EndIterator end, regex_set_results<Automaton::patterns> & found) noexcept {
+	constexpr auto & table = Automaton::table;
+	constexpr auto & masks = Automaton::masks;
+	constexpr size_t classes = Automaton::classes.count;
+
+	auto state = table.start_once;
+	Iterator current = begin;
+	for (; end != current; ++current) {
+		if (table.accepting(state)) {
+			found.bits |= masks.now[state / classes].bits;
+			// nothing new can be found
+			if ((found.bits & Automaton::set.members.bits) == Automaton::set.members.bits) return;
+		}
+		state = table.step(state, *current);
+		if (state == 0) return;
+	}
+	found.bits |= masks.at_end[state / classes].bits;
+}
+
+// NFA of big sets with lists instead of bitsets (only few positions are alive at once)
+template <typename Set> constexpr size_t regex_set_edges(const Set & set) noexcept {
+	size_t out{0};
+	for (size_t p = 0; p < decltype(set.nfa)::positions; ++p) {
+		out += set.nfa.follow[p].count();
+	}
+	return out;
+}
+
+template <typename Set> constexpr size_t regex_set_starts(const Set & set) noexcept {
+	using nfa_type = decltype(set.nfa);
+	size_t out{0};
+	for (size_t p = 0; p < nfa_type::positions; ++p) {
+		const size_t bytes = set.nfa.symbols[p].count();
+		if (set.nfa.follow[nfa_type::start_once].test(p)) out += bytes;
+		if (set.nfa.follow[nfa_type::start_loop].test(p)) out += bytes;
+	}
+	return out;
+}
+
+template <size_t Positions, size_t Edges, size_t Starts> struct regex_set_lists {
+	using index_type = std::conditional_t<(Positions < 0xFFFFu), uint16_t, uint32_t>;
+
+	// positions following every position
+	size_t follow_begin[Positions + 1]{};
+	index_type follow[Edges + 1]{};
+	// positions starting a match with given byte (at the beginning of the subject, and anywhere)
+	size_t start_begin[2][257]{};
+	index_type starts[Starts + 1]{};
+	bool last[Positions + 1]{};
+};
+
+template <size_t Edges, size_t Starts, typename Set> constexpr auto make_regex_set_lists(const Set & set) noexcept {
+	using nfa_type = decltype(set.nfa);
+	constexpr size_t positions = nfa_type::positions;
+	regex_set_lists<positions, Edges, Starts> out;
+	using index_type = typename decltype(out)::index_type;
+
+	size_t edges{0};
+	for (size_t p = 0; p < positions; ++p) {
+		out.follow_begin[p] = edges;
+		for (size_t q = 0; q < positions; ++q) {
+			if (set.nfa.follow[p].test(q)) out.follow[edges++] = static_cast<index_type>(q);
+		}
+		out.last[p] = set.nfa.accepting.test(p);
+	}
+	out.follow_begin[positions] = edges;
+
+	size_t starts{0};
+	const size_t start[2] = {nfa_type::start_once, nfa_type::start_loop};
+	for (size_t list = 0; list < 2; ++list) {
+		for (unsigned c = 0; c < 256; ++c) {
+			out.start_begin[list][c] = starts;
+			for (size_t q = 0; q < positions; ++q) {
+				if (set.nfa.follow[start[list]].test(q) && set.nfa.symbols[q].test(static_cast<unsigned char>(c))) out.starts[starts++] = static_cast<index_type>(q);
+			}
+		}
+		out.start_begin[list][256] = starts;
+	}
+	return out;
+}
+
+template <typename Automaton> struct regex_set_sparse {
+	static constexpr auto lists = make_regex_set_lists<regex_set_edges(Automaton::set), regex_set_starts(Automaton::set)>(Automaton::set);
+};
+
+template <typename Automaton, typename Iterator, typename EndIterator> 
+constexpr inline void regex_set_nfa_simulation(const Iterator begin, const EndIterator end, regex_set_results<Automaton::patterns> & found) noexcept {
+	constexpr auto & set = Automaton::set;
+	constexpr auto & lists = regex_set_sparse<Automaton>::lists;
+	constexpr size_t positions = decltype(set.nfa)::positions;
+	using index_type = typename std::remove_cv_t<std::remove_reference_t<decltype(lists)>>::index_type;
+
+	found.bits |= set.empty_now.bits;
+	found.bits |= set.empty_at_end.bits;
+	if (end == begin) found.bits |= set.empty_subject.bits;
+
+	index_type active[2][positions + 1]{};
+	size_t count[2]{0, 0};
+	size_t now{0};
+	// generation when the position was added to the next list
+	uint32_t stamp[positions + 1]{};
+	uint32_t generation{0};
+
+	const auto add = [&](size_t q, size_t next) {
+		// threads of already matched patterns are useless
+		if (stamp[q] == generation || found.test(set.owner[q])) return;
+		stamp[q] = generation;
+		active[next][count[next]++] = static_cast<index_type>(q);
+	};
+
+	size_t list{0};
+	Iterator current = begin;
+	for (; end != current; ++current) {
+		const unsigned char c = static_cast<unsigned char>(*current);
+		const size_t next = now ^ 1;
+		count[next] = 0;
+		++generation;
+		for (size_t i = 0; i < count[now]; ++i) {
+			const size_t p = active[now][i];
+			for (size_t e = lists.follow_begin[p]; e < lists.follow_begin[p + 1]; ++e) {
+				const size_t q = lists.follow[e];
+				if (set.nfa.symbols[q].test(c)) add(q, next);
+			}
+		}
+		for (size_t e = lists.start_begin[list][c]; e < lists.start_begin[list][c + 1]; ++e) {
+			add(lists.starts[e], next);
+		}
+		list = 1;
+		now = next;
+
+		for (size_t i = 0; i < count[now]; ++i) {
+			const size_t q = active[now][i];
+			if (lists.last[q] && !set.at_end[set.owner[q]]) found.set(set.owner[q]);
+		}
+		if ((found.bits & set.members.bits) == set.members.bits) return;
+		// only anchored patterns and no thread
+		if (count[now] == 0 && lists.start_begin[1][256] == 0) return;
+	}
+	for (size_t i = 0; i < count[now]; ++i) {
+		const size_t q = active[now][i];
+		if (lists.last[q]) found.set(set.owner[q]);
+	}
+}
+
+template <bool Whole, size_t Index, typename Pattern, typename CharT, typename Iterator, typename EndIterator, size_t N> 
+constexpr CTRE_FORCE_INLINE void regex_set_single(const Iterator begin, const EndIterator end, regex_set_results<N> & found) noexcept {
+	if constexpr (!regex_set_member<CharT, Pattern>()) {
+		if constexpr (Whole) {
+			if (match_re(begin, end, Pattern{})) found.set(Index);
+		} else {
+			if (search_re(begin, end, Pattern{})) found.set(Index);
+		}
+	}
+}
+
+// all patterns in one pass (members of the automaton), the rest is evaluated separately
+template <bool Whole, typename Iterator, typename EndIterator, typename... Patterns, size_t... Idx> 
+constexpr inline auto regex_set_re(const Iterator begin, const EndIterator end, ctll::list<Patterns...>, std::index_sequence<Idx...>) noexcept {
+	using char_type = dfa_character_t<Iterator>;
+	using automaton = regex_set_automaton<char_type, Whole, Patterns...>;
+	regex_set_results<sizeof...(Patterns)> found{};
+
+	if constexpr (!automaton::empty) {
+		if constexpr (automaton::fits) {
+			regex_set_dfa<automaton>(begin, end, found);
+		} else {
+			regex_set_nfa_simulation<automaton>(begin, end, found);
+		}
+	}
+	(regex_set_single<Whole, Idx, Patterns, char_type>(begin, end, found), ...);
+	return found;
+}
+
+template <typename Iterator, typename EndIterator, typename... Patterns> 
+constexpr inline auto regex_set_search_re(const Iterator begin, const EndIterator end, ctll::list<Patterns...> patterns) noexcept {
+	return regex_set_re<false>(begin, end, patterns, std::make_index_sequence<sizeof...(Patterns)>());
+}
+
+template <typename Iterator, typename EndIterator, typename... Patterns> 
+constexpr inline auto regex_set_match_re(const Iterator begin, const EndIterator end, ctll::list<Patterns...> patterns) noexcept {
+	return regex_set_re<true>(begin, end, patterns, std::make_index_sequence<sizeof...(Patterns)>());
+}
+
+template <typename... Patterns> struct regex_set_pattern { };
+
+// engine of ctre::regex_set (only for the set itself)
+struct regex_set_engine: engine_tag {
+	template <typename Iterator, typename EndIterator, typename... Patterns> static constexpr CTRE_FORCE_INLINE auto match(Iterator begin, EndIterator end, regex_set_pattern<Patterns...>) noexcept {
+		return regex_set_match_re(begin, end, ctll::list<Patterns...>{});
+	}
+	template <typename Iterator, typename EndIterator, typename... Patterns> static constexpr CTRE_FORCE_INLINE auto search(Iterator begin, EndIterator end, regex_set_pattern<Patterns...>) noexcept {
+		return regex_set_search_re(begin, end, ctll::list<Patterns...>{});
+	}
+};
+
+}
+
+#endif
+
+#ifndef CTRE__MATCH_BATCH__HPP
+#define CTRE__MATCH_BATCH__HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <string_view>
+#include <utility>
+
+// subjects advanced together by match_batch (their table lookups don't depend on each other)
+#ifndef CTRE_BATCH_LANES
+#define CTRE_BATCH_LANES 4
+#endif
+
+// shorter subjects are matched one by one
+#ifndef CTRE_BATCH_MIN_LENGTH
+#define CTRE_BATCH_MIN_LENGTH 32
+#endif
+
+namespace ctre {
+
+template <typename Subject> using batch_character_t = std::remove_cv_t<std::remove_reference_t<decltype(*std::data(std::declval<const Subject &>()))>>;
+
+// rest of one subject
+template <typename Table> constexpr CTRE_FORCE_INLINE bool finish_batch_subject(const Table & table, typename Table::index_type state, const unsigned char * ptr, const unsigned char * end) noexcept {
+	for (; ptr != end && !table.dead(state); ++ptr) {
+		state = table.step(state, *ptr);
+	}
+	return table.accepting(state);
+}
+
+// whole-subject matches of DFA-compatible patterns, lanes step through blocks of characters together and take the next subject when done
+template <typename Table, typename Subjects, typename Out, size_t... Lane> inline size_t dfa_match_batch(const Table & table, const Subjects & subjects, Out out, std::index_sequence<Lane...>) noexcept {
+	using index_type = typename Table::index_type;
+	constexpr size_t lanes = sizeof...(Lane);
+	
+	// every lane is only indexed by a constant (through the folds) so they can stay in registers
+	index_type state[lanes]{};
+	const unsigned char * ptr[lanes]{};
+	const unsigned char * end[lanes]{};
+	size_t position[lanes]{};
+	
+	auto next = std::begin(subjects);
+	const auto last = std::end(subjects);
+	size_t index{0};
+	size_t matched{0};
+	
+	const auto emit = [&](size_t i, bool result) {
+		out[i] = result;
+		matched += result;
+	};
+	
+	// next long enough subject into the lane (short ones are over before interleaving pays off, so they are matched right away)
+	const auto refill = [&](auto l) {
+		for (; next != last; ++next) {
+			const unsigned char * data = reinterpret_cast<const unsigned char *>(std::data(*next));
+			const size_t size = std::size(*next);
+			if (size < CTRE_BATCH_MIN_LENGTH) {
+				emit(index++, finish_batch_subject(table, table.start(false), data, data + size));
+				continue;
+			}
+			state[l] = table.start(false);
+			ptr[l] = data;
+			end[l] = data + size;
+			position[l] = index++;
+			++next;
+			return true;
+		}
+		return false;
+	};
+	
+	bool full = (refill(std::integral_constant<size_t, Lane>{}) && ...);
+	
+	while (full) {
+		// all lanes step through the shortest rest without checking anything
+		size_t block = std::numeric_limits<size_t>::max();
+		((block = std::min(block, static_cast<size_t>(end[Lane] - ptr[Lane]))), ...);
+		
+		for (size_t i = 0; i != block; ++i) {
+			((state[Lane] = table.step(state[Lane], ptr[Lane][i])), ...);
+		}
+		
+		const auto retire = [&](auto l) {
+			ptr[l] += block;
+			if (ptr[l] == end[l] || table.dead(state[l])) {
+				emit(position[l], ptr[l] == end[l] && table.accepting(state[l]));
+				if (!refill(l)) {
+					// this lane is done, the others are finished one by one
+					ptr[l] = end[l];
+					full = false;
+				}
+			}
+		};
+		(retire(std::integral_constant<size_t, Lane>{}), ...);
+	}
+	
+	// the rest (or fewer subjects than lanes)
+	const auto finish = [&](auto l) {
+		if (ptr[l] != end[l]) {
+			emit(position[l], finish_batch_subject(table, state[l], ptr[l], end[l]));
+		}
+	};
+	(finish(std::integral_constant<size_t, Lane>{}), ...);
+	return matched;
+}
+
+template <typename Table, typename Subjects, typename Out> inline size_t dfa_match_batch(const Table & table, const Subjects & subjects, Out out) noexcept {
+	return dfa_match_batch(table, subjects, out, std::make_index_sequence<CTRE_BATCH_LANES>());
+}
+
+// the table answers the same as match only with the DFA engine, or where backtracking match uses the DFA itself
+template <typename Engine, typename Iterator, typename Pattern> constexpr bool batch_uses_dfa() noexcept {
+	if constexpr (std::is_same_v<Engine, dfa>) {
+		return dfa_usable<Iterator, Pattern>();
+	} else if constexpr (std::is_same_v<Engine, backtracking>) {
+		return dfa_preferred<Iterator, Pattern>();
+	} else {
+		return false;
+	}
+}
+
+}
+
+#endif
+
+#ifndef CTRE__WRAPPER__HPP
+#define CTRE__WRAPPER__HPP
+
+#include <string_view>
+#include <string>
+
+namespace ctre {
+	
+struct zero_terminated_string_end_iterator {
+	constexpr inline zero_terminated_string_end_iterator() = default;
+	constexpr CTRE_FORCE_INLINE bool operator==(const char * ptr) const noexcept {
+		return *ptr == '\0';
+	} 
+	constexpr CTRE_FORCE_INLINE bool operator==(const wchar_t * ptr) const noexcept {
+		return *ptr == 0;
+	} 
+	constexpr CTRE_FORCE_INLINE bool operator!=(const char * ptr) const noexcept {
+		return *ptr != '\0';
+	} 
+	constexpr CTRE_FORCE_INLINE bool operator!=(const wchar_t * ptr) const noexcept {
+		return *ptr != 0;
+	} 
+};
+
+template <typename T> class RangeLikeType {
+	template <typename Y> static auto test(Y *) -> decltype(std::declval<const Y &>().begin(), std::declval<const Y &>().end(), std::true_type());
+	template <typename> static auto test(...) -> std::false_type;
+public:
+	static inline constexpr bool value = decltype(test<std::remove_reference_t<std::remove_const_t<T>>>( nullptr ))::value;
+};
+
+template <typename RE, typename... Modifiers> struct regular_expression {
+	using engine = engine_t<Modifiers...>;
+
+	template <typename IteratorBegin, typename IteratorEnd> constexpr CTRE_FORCE_INLINE static auto match_2(IteratorBegin begin, IteratorEnd end) noexcept {
+		return engine::match(begin, end, RE());
+	}
+	template <typename IteratorBegin, typename IteratorEnd> constexpr CTRE_FORCE_INLINE static auto search_2(IteratorBegin begin, IteratorEnd end) noexcept {
+		return engine::search(begin, end, RE());
+	}
+	template <typename IteratorBegin, typename IteratorEnd> constexpr CTRE_FORCE_INLINE static auto match_2(IteratorBegin begin, IteratorEnd end, step_budget & budget) noexcept {
+		if constexpr (engine::budgeted) {
+			return budgeted_results{engine::match(begin, end, RE(), budget), budget};
+		} else {
+			return budgeted_results{engine::match(begin, end, RE()), budget};
+		}
+	}
+	template <typename IteratorBegin, typename IteratorEnd> constexpr CTRE_FORCE_INLINE static auto search_2(IteratorBegin begin, IteratorEnd end, step_budget & budget) noexcept {
+		if constexpr (engine::budgeted) {
+			return budgeted_results{engine::search(begin, end, RE(), budget), budget};
+		} else {
+			return budgeted_results{engine::search(begin, end, RE()), budget};
+		}
+	}
+	// search restarted at `from` (by iterators, replace and split), `^` still matches only where the subject begins (or after '\n' with multiline)
+	template <typename IteratorBegin, typename IteratorEnd, typename = std::enable_if_t<!std::is_same_v<IteratorEnd, step_budget>>> constexpr CTRE_FORCE_INLINE static auto search_2(IteratorBegin begin, IteratorBegin from, IteratorEnd end) noexcept {
+		if constexpr (pattern_reach(RE{}).search_begin) {
+			if (begin != from) {
+				return engine::search_from(begin, from, end, RE());
+			}
+		}
+		return search_2(from, end);
+	}
+	template <typename IteratorBegin, typename IteratorEnd> constexpr CTRE_FORCE_INLINE static auto search_2(IteratorBegin begin, IteratorBegin from, IteratorEnd end, step_budget & budget) noexcept {
+		if constexpr (pattern_reach(RE{}).search_begin) {
+			if (begin != from) {
+				if constexpr (engine::budgeted) {
+					return budgeted_results{engine::search_from(begin, from, end, RE(), budget), budget};
+				} else {
+					return budgeted_results{engine::search_from(begin, from, end, RE()), budget};
+				}
+			}
+		}
+		return search_2(from, end, budget);
+	}
+	// the first non-empty match starting at `from` by backtracking (the dfa never finds an empty match where a longer one starts)
+	template <typename IteratorBegin, typename IteratorEnd> constexpr CTRE_FORCE_INLINE static auto non_empty_starts_with_2(IteratorBegin begin, IteratorBegin from, IteratorEnd end) noexcept {
+		return non_empty_starts_with_re(begin, from, end, RE());
+	}
+	// UTF-8 subject which is only ASCII from here is matched as bytes (same code points, no decoding)
+	template <typename Results> static constexpr CTRE_FORCE_INLINE auto utf8_results(const Results & results, const char * end) noexcept {
+		return decltype(engine::match(std::declval<utf8_iterator>(), std::declval<utf8_iterator>(), RE())){results, [end](const char * ptr) { return utf8_iterator{ptr, end, true}; }};
+	}
+	constexpr CTRE_FORCE_INLINE static auto match_2(utf8_iterator begin, utf8_iterator end) noexcept {
+		if (begin.ascii) {
+			return utf8_results(engine::match(begin.ptr, end.ptr, RE()), end.ptr);
+		}
+		return engine::match(begin, end, RE());
+	}
+	constexpr CTRE_FORCE_INLINE static auto search_2(utf8_iterator begin, utf8_iterator end) noexcept {
+		if (begin.ascii) {
+			return utf8_results(engine::search(begin.ptr, end.ptr, RE()), end.ptr);
+		}
+		return engine::search(begin, end, RE());
+	}
+	constexpr CTRE_FORCE_INLINE regular_expression() noexcept { }
+	constexpr CTRE_FORCE_INLINE regular_expression(RE) noexcept { }
+	constexpr CTRE_FORCE_INLINE static auto match(utf8_iterator begin, utf8_iterator end) noexcept {
+		return match_2(begin, end);
+	}
+	template <typename Iterator> constexpr CTRE_FORCE_INLINE static auto match(Iterator begin, Iterator end) noexcept {
+		return engine::match(begin, end, RE());
+	}
+	static constexpr CTRE_FORCE_INLINE auto match(const char * s) noexcept {
+		return match_2(s, zero_terminated_string_end_iterator());
+	}
+	static constexpr CTRE_FORCE_INLINE auto match(const wchar_t * s) noexcept {
+		return match_2(s, zero_terminated_string_end_iterator());
+	}
+	static constexpr CTRE_FORCE_INLINE auto match(const std::string & s) noexcept {
+		return match_2(s.c_str(), zero_terminated_string_end_iterator());
+	}
+	static constexpr CTRE_FORCE_INLINE auto match(const std::wstring & s) noexcept {
+		return match_2(s.c_str(), zero_terminated_string_end_iterator());
+	}
+	static constexpr CTRE_FORCE_INLINE auto match(std::string_view sv) noexcept {
+		return match(sv.begin(), sv.end());
+	}
+	static constexpr CTRE_FORCE_INLINE auto match(std::wstring_view sv) noexcept {
+		return match(sv.begin(), sv.end());
+	}
+	static constexpr CTRE_FORCE_INLINE auto match(std::u16string_view sv) noexcept {
+		return match(sv.begin(), sv.end());
+	}
+	static constexpr CTRE_FORCE_INLINE auto match(std::u32string_view sv) noexcept {
+		return match(sv.begin(), sv.end());
+	}
+	template <typename Range, typename = typename std::enable_if<RangeLikeType<Range>::value>::type> static constexpr CTRE_FORCE_INLINE auto match(Range && range) noexcept {
+		return match(std::begin(range), std::end(range));
+	}
+	// with a step budget (and cancellation), see budgeted_results
+	template <typename Iterator> constexpr CTRE_FORCE_INLINE static auto match(Iterator begin, Iterator end, step_budget & budget) noexcept {
+		return match_2(begin, end, budget);
+	}
+	static constexpr CTRE_FORCE_INLINE auto match(const char * s, step_budget & budget) noexcept {
+		return match_2(s, zero_terminated_string_end_iterator(), budget);
+	}
+	static constexpr CTRE_FORCE_INLINE auto match(const wchar_t * s, step_budget & budget) noexcept {
+		return match_2(s, zero_terminated_string_end_iterator(), budget);
+	}
+	template <typename Range, typename = typename std::enable_if<RangeLikeType<Range>::value>::type> static constexpr CTRE_FORCE_INLINE auto match(Range && range, step_budget & budget) noexcept {
+		return match_2(std::begin(range), std::end(range), budget);
+	}
+	template <typename Iterator> constexpr CTRE_FORCE_INLINE static auto search(Iterator begin, Iterator end) noexcept {
+		return engine::search(begin, end, RE());
+	}
+	constexpr CTRE_FORCE_INLINE static auto search(utf8_iterator begin, utf8_iterator end) noexcept {
+		return search_2(begin, end);
+	}
+	constexpr CTRE_FORCE_INLINE static auto search(const char * s) noexcept {
+		return search_2(s, zero_terminated_string_end_iterator());
+	}
+	static constexpr CTRE_FORCE_INLINE auto search(const wchar_t * s) noexcept {
+		return search_2(s, zero_terminated_string_end_iterator());
+	}
+	static constexpr CTRE_FORCE_INLINE auto search(const std::string & s) noexcept {
+		return search_2(s.c_str(), zero_terminated_string_end_iterator());
+	}
+	static constexpr CTRE_FORCE_INLINE auto search(const std::wstring & s) noexcept {
+		return search_2(s.c_str(), zero_terminated_string_end_iterator());
+	}
+	static constexpr CTRE_FORCE_INLINE auto search(std::string_view sv) noexcept {
+		return search(sv.begin(), sv.end());
+	}
+	static constexpr CTRE_FORCE_INLINE auto search(std::wstring_view sv) noexcept {
+		return search(sv.begin(), sv.end());
+	}
+	static constexpr CTRE_FORCE_INLINE auto search(std::u16string_view sv) noexcept {
+		return search(sv.begin(), sv.end());
+	}
+	static constexpr CTRE_FORCE_INLINE auto search(std::u32string_view sv) noexcept {
+		return search(sv.begin(), sv.end());
+	}
+	template <typename Range> static constexpr CTRE_FORCE_INLINE auto search(Range && range) noexcept {
+		return search(std::begin(range), std::end(range));
+	}
+	template <typename Iterator> constexpr CTRE_FORCE_INLINE static auto search(Iterator begin, Iterator end, step_budget & budget) noexcept {
+		return search_2(begin, end, budget);
+	}
+	static constexpr CTRE_FORCE_INLINE auto search(const char * s, step_budget & budget) noexcept {
+		return search_2(s, zero_terminated_string_end_iterator(), budget);
+	}
+	static constexpr CTRE_FORCE_INLINE auto search(const wchar_t * s, step_budget & budget) noexcept {
+		return search_2(s, zero_terminated_string_end_iterator(), budget);
+	}
+	template <typename Range, typename = typename std::enable_if<RangeLikeType<Range>::value>::type> static constexpr CTRE_FORCE_INLINE auto search(Range && range, step_budget & budget) noexcept {
+		return search_2(std::begin(range), std::end(range), budget);
+	}
+	// whole match of every subject (a range of contiguous strings) into out[i], returns the number of matched subjects
+	template <typename Subjects, typename Out> static inline size_t match_batch(const Subjects & subjects, Out out) noexcept {
+		using subject_type = std::remove_cv_t<std::remove_reference_t<decltype(*std::begin(subjects))>>;
+		using char_type = batch_character_t<subject_type>;
+		if constexpr (batch_uses_dfa<engine, const char_type *, RE>()) {
+			using automaton = dfa_automaton<char_type, typename decltype(strip_anchors(RE{}))::type>;
+			return dfa_match_batch(automaton::table, subjects, out);
+		} else {
+			size_t index{0};
+			size_t matched{0};
+			for (const auto & subject: subjects) {
+				const bool result = bool(match(std::data(subject), std::data(subject) + std::size(subject)));
+				out[index++] = result;
+				matched += result;
+			}
+			return matched;
+		}
+	}
+};
+
+template <typename RE> regular_expression(RE) -> regular_expression<RE>;
+
+}
+
+#endif
+
+#ifndef __EDG__
+
+namespace ctre {
+
+// in C++17 (clang & gcc with gnu extension) we need translate character pack into ctll::fixed_string
+// in C++20 we have `class nontype template parameters`
+
+#if !(__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
+template <typename CharT, CharT... input> static inline constexpr auto _fixed_string_reference = ctll::fixed_string< sizeof...(input)>({input...});
+#endif	
+
+namespace literals {
+	
+// clang and GCC <9 supports LITERALS with packs
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wgnu-string-literal-operator-template"
+#define CTRE_ENABLE_LITERALS
+#endif
+
+#ifdef __INTEL_COMPILER
+// not enable literals
+#elif defined __GNUC__
+#if not(__GNUC__ == 9)
+#define CTRE_ENABLE_LITERALS
+#endif
+#endif
+
+#ifdef CTRE_ENABLE_LITERALS
+	
+// add this when we will have concepts
+// requires ctll::parser<ctre::pcre, _fixed_string_reference<CharT, charpack...>, ctre::pcre_actions>::template correct_with<pcre_context<>>
+
+#if !(__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
+template <typename CharT, CharT... charpack> CTRE_FLATTEN constexpr CTRE_FORCE_INLINE auto operator""_ctre() noexcept {
+	constexpr auto & _input = _fixed_string_reference<CharT, charpack...>;
+#else
+template <ctll::fixed_string input> CTRE_FLATTEN constexpr CTRE_FORCE_INLINE auto operator""_ctre() noexcept {
+	constexpr auto _input = input; // workaround for GCC 9 bug 88092
+#endif
+	using tmp = typename ctll::parser<ctre::pcre, _input, ctre::pcre_actions>::template output<pcre_context<>>;
+	static_assert(tmp(), "Regular Expression contains syntax error.");
+	if constexpr (tmp()) {
+		using re = decltype(with_modes<false>(front(typename tmp::output_type::stack_type())));
+		return ctre::regular_expression(re());
+	} else {
+		return ctre::regular_expression(reject());
+	}
+}
+
+// this will need to be fixed with C++20
+#if !(__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
+template <typename CharT, CharT... charpack> CTRE_FLATTEN constexpr CTRE_FORCE_INLINE auto operator""_ctre_id() noexcept {
+	return id<charpack...>();
+}
+#endif
+
+#endif // CTRE_ENABLE_LITERALS
+
+}
+
+namespace test_literals {
+	
+#ifdef CTRE_ENABLE_LITERALS
+
+#if !(__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
+template <typename CharT, CharT... charpack> CTRE_FLATTEN constexpr inline auto operator""_ctre_test() noexcept {
+	constexpr auto & _input = _fixed_string_reference<CharT, charpack...>;
+#else
+template <ctll::fixed_string input> CTRE_FLATTEN constexpr inline auto operator""_ctre_test() noexcept {
+	constexpr auto _input = input; // workaround for GCC 9 bug 88092
+#endif
+	return ctll::parser<ctre::pcre, _input>::template correct_with<>;
+}
+
+#if !(__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
+template <typename CharT, CharT... charpack> CTRE_FLATTEN constexpr inline auto operator""_ctre_gen() noexcept {
+	constexpr auto & _input = _fixed_string_reference<CharT, charpack...>;
+#else
+template <ctll::fixed_string input> CTRE_FLATTEN constexpr inline auto operator""_ctre_gen() noexcept {
+	constexpr auto _input = input; // workaround for GCC 9 bug 88092
+#endif
+	using tmp = typename ctll::parser<ctre::pcre, _input, ctre::pcre_actions>::template output<pcre_context<>>;
+	static_assert(tmp(), "Regular Expression contains syntax error.");
+	return typename tmp::output_type::stack_type();
+}
+
+#if !(__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
+template <typename CharT, CharT... charpack> CTRE_FLATTEN constexpr CTRE_FORCE_INLINE auto operator""_ctre_syntax() noexcept {
+	constexpr auto & _input = _fixed_string_reference<CharT, charpack...>;
+#else
+template <ctll::fixed_string input> CTRE_FLATTEN constexpr CTRE_FORCE_INLINE auto operator""_ctre_syntax() noexcept {
+	constexpr auto _input = input; // workaround for GCC 9 bug 88092
+#endif
+	return ctll::parser<ctre::pcre, _input, ctre::pcre_actions>::template correct_with<pcre_context<>>;
+}
+
+#endif
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+} // literals
+
+} // ctre
+
+#endif
+
+#endif
+
+#ifndef CTRE_V2__CTRE__FUNCTIONS__HPP
+#define CTRE_V2__CTRE__FUNCTIONS__HPP
+
+namespace ctre {
+
+#if !(__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
+// avoiding CTAD limitation in C++17
+template <typename CharT, size_t N> class pattern: public ctll::fixed_string<N> {
+	using parent = ctll::fixed_string<N>;
+public:
+	constexpr pattern(const CharT (&input)[N]) noexcept: parent(input) { }
+};
+
+template <typename CharT, size_t N> pattern(const CharT (&)[N]) -> pattern<CharT, N>;
+
+// for better examples
+template <typename CharT, size_t N> class fixed_string: public ctll::fixed_string<N> {
+	using parent = ctll::fixed_string<N>;
+public:
+	constexpr fixed_string(const CharT (&input)[N]) noexcept: parent(input) { }
+};
+
+template <typename CharT, size_t N> fixed_string(const CharT (&)[N]) -> fixed_string<CharT, N>;
+#endif
+
+#if (__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
+template <ctll::fixed_string input> CTRE_FLATTEN constexpr CTRE_FORCE_INLINE auto re() noexcept {
+constexpr auto _input = input; // workaround for GCC 9 bug 88092
+#else
+template <auto & input> CTRE_FLATTEN constexpr CTRE_FORCE_INLINE auto re() noexcept {	
+constexpr auto & _input = input; 
+#endif
+	
+	using tmp = typename ctll::parser<ctre::pcre, _input, ctre::pcre_actions>::template output<pcre_context<>>;
+	static_assert(tmp(), "Regular Expression contains syntax error.");
+	using re = decltype(with_modes<false>(front(typename tmp::output_type::stack_type())));
+	return ctre::regular_expression(re());
+}
+
+// in moment when we get C++20 support this will start to work :)
+
+template <typename RE, typename... Modifiers> struct regex_match_t {
+	template <typename... Args> CTRE_FORCE_INLINE constexpr auto operator()(Args && ... args) const noexcept {
+		auto re_obj = ctre::regular_expression<RE, Modifiers...>();
+		return re_obj.match(std::forward<Args>(args)...);
+	}
+	template <typename... Args> CTRE_FORCE_INLINE constexpr auto try_extract(Args && ... args) const noexcept {
+		return operator()(std::forward<Args>(args)...);
+	}
+};
+
+template <typename RE, typename... Modifiers> struct regex_match_batch_t {
+	template <typename Subjects, typename Out> CTRE_FORCE_INLINE size_t operator()(const Subjects & subjects, Out out) const noexcept {
+		return ctre::regular_expression<RE, Modifiers...>::match_batch(subjects, out);
+	}
+};
+
+template <typename RE, typename... Modifiers> struct regex_search_t {
+	template <typename... Args> CTRE_FORCE_INLINE constexpr auto operator()(Args && ... args) const noexcept {
+		auto re_obj = ctre::regular_expression<RE, Modifiers...>();
+		return re_obj.search(std::forward<Args>(args)...);
+	}
+	template <typename... Args> CTRE_FORCE_INLINE constexpr auto try_extract(Args && ... args) const noexcept {
+		return operator()(std::forward<Args>(args)...);
+	}
+};
+
+#if (__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
+
+template <auto input, bool CaseInsensitive = false, bool Multiline = false> struct regex_builder {
+	static constexpr auto _input = input;
+	using _tmp = typename ctll::parser<ctre::pcre, _input, ctre::pcre_actions>::template output<pcre_context<>>;
+	static_assert(_tmp(), "Regular Expression contains syntax error.");
+	using type = ctll::conditional<(bool)(_tmp()), decltype(with_modes<CaseInsensitive, Multiline>(ctll::front(typename _tmp::output_type::stack_type()))), ctll::list<reject>>;
+};
+
+template <ctll::fixed_string input, typename... Modifiers> static constexpr inline auto match = regex_match_t<typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type, Modifiers...>();
+
+template <ctll::fixed_string input, typename... Modifiers> static constexpr inline auto search = regex_search_t<typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type, Modifiers...>();
+
+template <ctll::fixed_string input, typename... Modifiers> static constexpr inline auto match_batch = regex_match_batch_t<typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type, Modifiers...>();
+
+template <ctll::fixed_string input, typename... Modifiers> using stream = stream_matcher<typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type>;
+
+#else
+
+template <auto & input, bool CaseInsensitive = false, bool Multiline = false> struct regex_builder {
+	using _tmp = typename ctll::parser<ctre::pcre, input, ctre::pcre_actions>::template output<pcre_context<>>;
+	static_assert(_tmp(), "Regular Expression contains syntax error.");
+	using type = ctll::conditional<(bool)(_tmp()), decltype(with_modes<CaseInsensitive, Multiline>(ctll::front(typename _tmp::output_type::stack_type()))), ctll::list<reject>>;
+};
+
+template <auto & input, typename... Modifiers> static constexpr inline auto match = regex_match_t<typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type, Modifiers...>();
+
+template <auto & input, typename... Modifiers> static constexpr inline auto search = regex_search_t<typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type, Modifiers...>();
+
+template <auto & input, typename... Modifiers> static constexpr inline auto match_batch = regex_match_batch_t<typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type, Modifiers...>();
+
+template <auto & input, typename... Modifiers> using stream = stream_matcher<typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type>;
+
+#endif
+
+// several patterns in one pass over the subject, results say which of them matched
+template <typename... REs> struct regex_set_t {
+	static_assert(sizeof...(REs) > 0, "Regex set needs at least one pattern.");
+	using re_type = ctre::regular_expression<regex_set_pattern<REs...>, regex_set_engine>;
+
+	static constexpr size_t size() noexcept {
+		return sizeof...(REs);
+	}
+	template <typename... Args> CTRE_FORCE_INLINE constexpr auto match(Args && ... args) const noexcept {
+		return re_type::match(std::forward<Args>(args)...);
+	}
+	template <typename... Args> CTRE_FORCE_INLINE constexpr auto search(Args && ... args) const noexcept {
+		return re_type::search(std::forward<Args>(args)...);
+	}
+};
+
+#if (__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
+
+template <ctll::fixed_string... inputs> static constexpr inline auto regex_set = regex_set_t<typename regex_builder<inputs>::type...>();
+
+#else
+
+template <auto &... inputs> static constexpr inline auto regex_set = regex_set_t<typename regex_builder<inputs>::type...>();
+
+#endif
+
+}
+
+#endif
+
+#ifndef CTRE_V2__CTRE__ITERATOR__HPP
+#define CTRE_V2__CTRE__ITERATOR__HPP
+
+namespace ctre {
+
+struct regex_end_iterator {
+	constexpr regex_end_iterator() noexcept { }
+};
+
+// regular expression sharing one step budget between all searches of a range
+template <typename RE> struct regex_with_budget {
+	step_budget * budget;
+	
+	template <typename IteratorBegin, typename IteratorEnd> constexpr CTRE_FORCE_INLINE auto search_2(IteratorBegin begin, IteratorEnd end) const noexcept {
+		return RE::search_2(begin, end, *budget);
+	}
+	template <typename IteratorBegin, typename IteratorEnd> constexpr CTRE_FORCE_INLINE auto search_2(IteratorBegin begin, IteratorBegin from, IteratorEnd end) const noexcept {
+		return RE::search_2(begin, from, end, *budget);
+	}
+};
+
+template <typename BeginIterator, typename EndIterator, typename RE> struct regex_iterator {
+	const BeginIterator begin;
+	BeginIterator current;
+	const EndIterator end;
+	RE re;
+	decltype(std::declval<const RE &>().search_2(std::declval<BeginIterator>(), std::declval<EndIterator>())) current_match;
+
+	constexpr regex_iterator(BeginIterator begin, EndIterator end, RE re = RE()) noexcept: begin{begin}, current{begin}, end{end}, re{re}, current_match{re.search_2(current, end)} {
+		if (current_match) {
+			current = current_match.template get<0>().end();
+		}
+	}
+	constexpr const auto & operator*() const noexcept {
+		return current_match;
+	}
+	constexpr regex_iterator & operator++() noexcept {
+		current_match = re.search_2(begin, current, end);
+		if (current_match) {
+			current = current_match.template get<0>().end();
+		}
+		return *this;
+	}
+	constexpr regex_iterator operator++(int) noexcept {
+		auto previous = *this;
+		current_match = re.search_2(begin, current, end);
+		if (current_match) {
+			current = current_match.template get<0>().end();
+		}
+		return previous;
+	}
+};
+
+template <typename BeginIterator, typename EndIterator, typename RE> constexpr bool operator!=(const regex_iterator<BeginIterator, EndIterator, RE> & left, regex_end_iterator) {
+	return bool(left.current_match);
+}
+
+template <typename BeginIterator, typename EndIterator, typename RE> constexpr bool operator!=(regex_end_iterator, const regex_iterator<BeginIterator, EndIterator, RE> & right) {
+	return bool(right.current_match);
+}
+
+template <typename BeginIterator, typename EndIterator, typename RE> constexpr auto iterator(BeginIterator begin, EndIterator end, RE) noexcept {
+	return regex_iterator<BeginIterator, EndIterator, RE>(begin, end);
+}
+
+constexpr auto iterator() noexcept {
+	return regex_end_iterator{};
+}
+
+template <typename Subject, typename RE> constexpr auto iterator(const Subject & subject, RE re) noexcept {
+	return iterator(subject.begin(), subject.end(), re);
+}
+
+#if (__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
+template <ctll::fixed_string input, typename... Modifiers, typename BeginIterator, typename EndIterator> CTRE_FLATTEN constexpr CTRE_FORCE_INLINE auto iterator(BeginIterator begin, EndIterator end) noexcept {
+	using re = typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type;
+	return iterator(begin, end, regular_expression<re, Modifiers...>());
+}
+#endif
+
+#if (__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
+template <ctll::fixed_string input, typename... Modifiers, typename Subject> CTRE_FLATTEN constexpr CTRE_FORCE_INLINE auto iterator(const Subject & subject) noexcept {
+	using re = typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type;
+	return iterator(subject.begin(), subject.end(), regular_expression<re, Modifiers...>());
+}
+#endif
+
+} // ctre
+
+#endif
+
+#ifndef CTRE_V2__CTRE__RANGE__HPP
+#define CTRE_V2__CTRE__RANGE__HPP
+
+namespace ctre {
+
+template <typename BeginIterator, typename EndIterator, typename RE> struct regex_range {
+	BeginIterator _begin;
+	const EndIterator _end;
+	RE _re;
+	constexpr regex_range(BeginIterator begin, EndIterator end, RE re = RE()) noexcept: _begin{begin}, _end{end}, _re{re} { }
+	
+	constexpr auto begin() const noexcept {
+		return regex_iterator<BeginIterator, EndIterator, RE>(_begin, _end, _re);
+	}
+	constexpr auto end() const noexcept {
+		return regex_end_iterator{};
+	}
+};
+
+template <typename BeginIterator, typename EndIterator, typename RE> constexpr auto range(BeginIterator begin, EndIterator end, RE) noexcept {
+	return regex_range<BeginIterator, EndIterator, RE>(begin, end);
+}
+
+#if (__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
+template <ctll::fixed_string input, typename... Modifiers, typename BeginIterator, typename EndIterator> constexpr auto range(BeginIterator begin, EndIterator end) noexcept {
+	using re = typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type;
+	auto re_obj = regular_expression<re, Modifiers...>();
+	return range(begin, end, re_obj);
+}
+#endif
+
+template <typename Subject, typename RE> constexpr auto range(const Subject & subject, RE re) noexcept {
+	return range(subject.begin(), subject.end(), re);
+}
+
+template <typename RE> constexpr auto range(const char * subject, RE re) noexcept {
+	return range(subject, zero_terminated_string_end_iterator(), re);
+}
+
+// all searches of the range share the budget, iteration stops when it's exhausted
+template <typename BeginIterator, typename EndIterator, typename RE> constexpr auto range(BeginIterator begin, EndIterator end, RE, step_budget & budget) noexcept {
+	return regex_range<BeginIterator, EndIterator, regex_with_budget<RE>>(begin, end, regex_with_budget<RE>{&budget});
+}
+
+template <typename Subject, typename RE> constexpr auto range(const Subject & subject, RE re, step_budget & budget) noexcept {
+	return range(subject.begin(), subject.end(), re, budget);
+}
+
+template <typename RE> constexpr auto range(const char * subject, RE re, step_budget & budget) noexcept {
+	return range(subject, zero_terminated_string_end_iterator(), re, budget);
+}
+
+#if (__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
+template <ctll::fixed_string input, typename... Modifiers, typename Subject> constexpr auto range(const Subject & subject) noexcept {
+	using re = typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type;
+	auto re_obj = regular_expression<re, Modifiers...>();
+	return range(subject.begin(), subject.end(), re_obj);
+}
+
+template <ctll::fixed_string input, typename... Modifiers, typename Subject> constexpr auto range(const Subject & subject, step_budget & budget) noexcept {
+	using re = typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type;
+	auto re_obj = regular_expression<re, Modifiers...>();
+	return range(subject.begin(), subject.end(), re_obj, budget);
+}
+#else
+template <auto & input, typename... Modifiers, typename Subject> constexpr auto range(const Subject & subject) noexcept {
+	using re = typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type;
+	auto re_obj = regular_expression<re, Modifiers...>();
+	return range(subject.begin(), subject.end(), re_obj);
+}
+
+template <auto & input, typename... Modifiers, typename Subject> constexpr auto range(const Subject & subject, step_budget & budget) noexcept {
+	using re = typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type;
+	auto re_obj = regular_expression<re, Modifiers...>();
+	return range(subject.begin(), subject.end(), re_obj, budget);
+}
+#endif
+
+}
+
+#endif
+
+#ifndef CTRE__SPLIT__HPP
+#define CTRE__SPLIT__HPP
+
+#include <iterator>
+#include <string_view>
+
+namespace ctre {
+
+// only matchers with a known pattern can skip the handling of empty matches
+template <typename RE> constexpr bool splits_on_empty = true;
+template <typename RE, typename... Modifiers> constexpr bool splits_on_empty<regular_expression<RE, Modifiers...>> = (pattern_length(RE{}).min == 0);
+
+// pieces of the subject between matches as views: N matches cut it into N + 1 pieces (the first and the last one too, all of them can be empty),
+// an empty match doesn't cut at the beginning of a piece or at the end of the subject, the search continues after its position
+// (so `,` splits "a,,b," into "a", "", "b", "" and `x*` splits "axbc" into "a", "b", "c"),
+// `^` matches at the beginning of the subject (or of its lines with multiline), not of every piece
+// (so `^,` splits ",," into "", "," and multiline `^` splits "a\nb" into "a\n", "b")
+template <typename CharT, typename RE> struct regex_split_iterator {
+	// current piece and the subject after the match which ended it
+	std::basic_string_view<CharT> piece;
+	std::basic_string_view<CharT> rest;
+	// where the whole subject begins (for `^`)
+	const CharT * subject;
+	RE re;
+	// the piece is the last one (no match after it)
+	bool last{false};
+	bool done{false};
+
+	constexpr regex_split_iterator(std::basic_string_view<CharT> subject, RE re = RE()) noexcept: rest{subject}, subject{subject.data()}, re{re} {
+		cut();
+	}
+	constexpr void cut() noexcept {
+		const CharT * const begin = rest.data();
+		const CharT * const end = begin + rest.size();
+		for (const CharT * from = begin; ; ) {
+			const auto result = re.search_2(subject, from, end);
+			if (!result) {
+				break;
+			}
+			const auto match = result.template get<0>();
+			if constexpr (splits_on_empty<RE>) {
+				if (match.begin() == match.end() && (match.begin() == begin || match.begin() == end)) {
+					if (match.begin() == end) {
+						break;
+					}
+					from = match.begin() + 1;
+					continue;
+				}
+			}
+			piece = std::basic_string_view<CharT>(begin, static_cast<size_t>(match.begin() - begin));
+			rest.remove_prefix(static_cast<size_t>(match.end() - begin));
+			return;
+		}
+		piece = rest;
+		last = true;
+	}
+	constexpr std::basic_string_view<CharT> operator*() const noexcept {
+		return piece;
+	}
+	constexpr regex_split_iterator & operator++() noexcept {
+		if (last) {
+			done = true;
+		} else {
+			cut();
+		}
+		return *this;
+	}
+	constexpr regex_split_iterator operator++(int) noexcept {
+		auto previous = *this;
+		operator++();
+		return previous;
+	}
+};
+
+template <typename CharT, typename RE> constexpr bool operator!=(const regex_split_iterator<CharT, RE> & left, regex_end_iterator) noexcept {
+	return !left.done;
+}
+
+template <typename CharT, typename RE> constexpr bool operator!=(regex_end_iterator, const regex_split_iterator<CharT, RE> & right) noexcept {
+	return !right.done;
+}
+
+template <typename CharT, typename RE> constexpr bool operator==(const regex_split_iterator<CharT, RE> & left, regex_end_iterator) noexcept {
+	return left.done;
+}
+
+template <typename CharT, typename RE> constexpr bool operator==(regex_end_iterator, const regex_split_iterator<CharT, RE> & right) noexcept {
+	return right.done;
+}
+
+template <typename CharT, typename RE> struct regex_split_range {
+	std::basic_string_view<CharT> _subject;
+	RE _re;
+
+	constexpr auto begin() const noexcept {
+		return regex_split_iterator<CharT, RE>(_subject, _re);
+	}
+	constexpr auto end() const noexcept {
+		return regex_end_iterator{};
+	}
+};
+
+template <typename Subject, typename RE, typename = std::enable_if_t<RangeLikeType<Subject>::value>> constexpr auto split(const Subject & subject, RE re) noexcept {
+	using char_type = std::remove_cv_t<std::remove_pointer_t<decltype(std::data(subject))>>;
+	return regex_split_range<char_type, RE>{std::basic_string_view<char_type>(std::data(subject), std::size(subject)), re};
+}
+
+template <typename CharT, typename RE> constexpr auto split(const CharT * subject, RE re) noexcept {
+	return regex_split_range<CharT, RE>{std::basic_string_view<CharT>(subject), re};
+}
+
+#if (__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
+template <ctll::fixed_string input, typename... Modifiers, typename Subject> constexpr auto split(const Subject & subject) noexcept {
+	using re = typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type;
+	return split(subject, regular_expression<re, Modifiers...>());
+}
+#else
+template <auto & input, typename... Modifiers, typename Subject> constexpr auto split(const Subject & subject) noexcept {
+	using re = typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type;
+	return split(subject, regular_expression<re, Modifiers...>());
+}
+#endif
+
+}
+
+#endif
+
+#ifndef CTRE__PARALLEL_RANGE__HPP
+#define CTRE__PARALLEL_RANGE__HPP
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// nominal size of the chunks searched independently by parallel_range
+#ifndef CTRE_PARALLEL_CHUNK_SIZE
+#define CTRE_PARALLEL_CHUNK_SIZE (1u << 20)
+#endif
+
+namespace ctre {
+
+// runs task(0) ... task(count - 1) on a few threads, each of them takes the next index when it's done with the previous one
+struct thread_executor {
+	unsigned threads = std::thread::hardware_concurrency();
+	
+	template <typename Task> void operator()(size_t count, const Task & task) const {
+		std::atomic<size_t> next{0};
+		const auto work = [&] {
+			for (size_t i = next.fetch_add(1, std::memory_order_relaxed); i < count; i = next.fetch_add(1, std::memory_order_relaxed)) {
+				task(i);
+			}
+		};
+		const size_t helpers = std::min<size_t>(threads, count) - (count != 0 && threads != 0);
+		std::vector<std::thread> pool;
+		pool.reserve(helpers);
+		for (size_t i = 0; i != helpers; ++i) {
+			pool.emplace_back(work);
+		}
+		work();
+		for (auto & thread: pool) {
+			thread.join();
+		}
+	}
+};
+
+// matches found by parallel_range, they are kept in the vectors of their chunks and iterated as runs in the order of the sequence
+template <typename Result> class parallel_matches {
+	struct piece {
+		size_t source;
+		size_t from;
+		size_t to;
+	};
+	
+	std::vector<std::vector<Result>> chunks{};
+	std::vector<piece> pieces{};
+	size_t count{0};
+	
+	template <typename, typename, typename CharT, typename Executor> friend auto parallel_search(const CharT *, const CharT *, Executor &&);
+	
+	void add(size_t source, size_t from, size_t to) {
+		if (!pieces.empty() && pieces.back().source == source && pieces.back().to == from) {
+			pieces.back().to = to;
+		} else {
+			pieces.push_back(piece{source, from, to});
+		}
+		count += to - from;
+	}
+	
+public:
+	class iterator {
+		const parallel_matches * owner{nullptr};
+		size_t current{0};
+		size_t index{0};
+		
+		friend class parallel_matches;
+		
+		constexpr iterator(const parallel_matches * owner, size_t current, size_t index) noexcept: owner{owner}, current{current}, index{index} { }
+	public:
+		using value_type = Result;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const Result *;
+		using reference = const Result &;
+		using iterator_category = std::forward_iterator_tag;
+		
+		constexpr iterator() noexcept = default;
+		
+		const Result & operator*() const noexcept {
+			return owner->chunks[owner->pieces[current].source][index];
+		}
+		const Result * operator->() const noexcept {
+			return &**this;
+		}
+		iterator & operator++() noexcept {
+			if (++index == owner->pieces[current].to) {
+				index = (++current != owner->pieces.size()) ? owner->pieces[current].from : 0;
+			}
+			return *this;
+		}
+		iterator operator++(int) noexcept {
+			auto previous = *this;
+			++*this;
+			return previous;
+		}
+		constexpr friend bool operator==(const iterator & lhs, const iterator & rhs) noexcept {
+			return lhs.current == rhs.current && lhs.index == rhs.index;
+		}
+		constexpr friend bool operator!=(const iterator & lhs, const iterator & rhs) noexcept {
+			return !(lhs == rhs);
+		}
+	};
+	
+	iterator begin() const noexcept {
+		return iterator(this, 0, pieces.empty() ? 0 : pieces.front().from);
+	}
+	iterator end() const noexcept {
+		return iterator(this, pieces.size(), 0);
+	}
+	size_t size() const noexcept {
+		return count;
+	}
+	bool empty() const noexcept {
+		return count == 0;
+	}
+};
+
+// all matches of ctre::range in the same order, chunks of the subject are searched by the executor and their matches are stitched together:
+// a chunk's matches are taken as they are when the previous match ends before them (the searches didn't depend on where they started)
+// and searched again from the end of the previous match when it overlaps them
+template <typename Pattern, typename RE, typename CharT, typename Executor> auto parallel_search(const CharT * begin, const CharT * end, Executor && executor) {
+	using result_type = decltype(RE::search_2(begin, end));
+	constexpr match_reach reach = pattern_reach(Pattern{});
+	constexpr length_range length = pattern_length(Pattern{});
+	
+	// how far a search for matches starting before `boundary` has to look
+	constexpr bool bounded = length.max != length_range::infinite;
+	constexpr bool chunked = !reach.subject_end && (bounded || !reach.newline);
+	const auto limit_of = [=](const CharT * boundary) {
+		if constexpr (!chunked) {
+			return end;
+		} else if constexpr (bounded) {
+			return static_cast<size_t>(end - boundary) > length.max ? boundary + length.max : end;
+		} else {
+			return std::find(boundary, end, CharT('\n'));
+		}
+	};
+	
+	// chunks start at the beginning of a line if there is one nearby
+	const size_t size = static_cast<size_t>(end - begin);
+	const size_t count = chunked ? std::max<size_t>((size + CTRE_PARALLEL_CHUNK_SIZE - 1) / CTRE_PARALLEL_CHUNK_SIZE, 1) : 1;
+	std::vector<const CharT *> bounds(count + 1, end);
+	bounds[0] = begin;
+	for (size_t i = 1; i < count; ++i) {
+		const CharT * nominal = begin + i * CTRE_PARALLEL_CHUNK_SIZE;
+		const CharT * const next = (static_cast<size_t>(end - nominal) > CTRE_PARALLEL_CHUNK_SIZE) ? nominal + CTRE_PARALLEL_CHUNK_SIZE : end;
+		const CharT * const line = std::find(nominal, next, CharT('\n'));
+		bounds[i] = (line != next) ? line + 1 : nominal;
+	}
+	
+	// the last chunk also owns (empty) matches at the very end
+	const auto owns = [=](const CharT * position, const CharT * boundary) {
+		return position < boundary || boundary == end;
+	};
+	
+	// empty match ends the sequence (ctre::range would return it again and again)
+	parallel_matches<result_type> out;
+	out.chunks.resize(count + 1);
+	executor(count, [&](size_t i) {
+		const CharT * const boundary = bounds[i + 1];
+		const CharT * const limit = limit_of(boundary);
+		for (const CharT * position = bounds[i];;) {
+			const auto result = RE::search_2(begin, position, limit);
+			if (!result || !owns(result.template get<0>().begin(), boundary)) break;
+			out.chunks[i].push_back(result);
+			if (result.template get<0>().end() == result.template get<0>().begin()) break;
+			position = result.template get<0>().end();
+		}
+	});
 	
-#ifdef CTRE_ENABLE_LITERALS
-
-#if !(__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
-template <typename CharT, CharT... charpack> CTRE_FLATTEN constexpr inline auto operator""_ctre_test() noexcept {
-	constexpr auto & _input = _fixed_string_reference<CharT, charpack...>;
-#else
-template <ctll::fixed_string input> CTRE_FLATTEN constexpr inline auto operator""_ctre_test() noexcept {
-	constexpr auto _input = input; // workaround for GCC 9 bug 88092
-#endif
-	return ctll::parser<ctre::pcre, _input>::template correct_with<>;
+	// merging only looks at the beginnings of the chunks, matches searched again are in the last vector
+	std::vector<result_type> & searched_again = out.chunks[count];
+	const CharT * position = begin;
+	bool stopped = false;
+	
+	for (size_t i = 0; i != count && !stopped; ++i) {
+		const CharT * const boundary = bounds[i + 1];
+		const std::vector<result_type> & chunk = out.chunks[i];
+		size_t next{0};
+		
+		while (owns(position, boundary)) {
+			// nothing starts between the previous match of the chunk (or its beginning) and the next one
+			const CharT * const searched = (next == 0) ? bounds[i] : chunk[next - 1].template get<0>().end();
+			if (searched <= std::max(position, bounds[i])) {
+				if (next == chunk.size()) break;
+				if (chunk[next].template get<0>().begin() < position) {
+					++next;
+					continue;
+				}
+				// from here the chunk's own matches are the sequence
+				out.add(i, next, chunk.size());
+				position = chunk.back().template get<0>().end();
+				stopped = (chunk.back().template get<0>().begin() == position);
+				break;
+			}
+			
+			// the previous match overlaps the chunk's matches, search again after it
+			const auto result = RE::search_2(begin, position, limit_of(boundary));
+			if (!result || !owns(result.template get<0>().begin(), boundary)) break;
+			searched_again.push_back(result);
+			out.add(count, searched_again.size() - 1, searched_again.size());
+			position = result.template get<0>().end();
+			if (result.template get<0>().begin() == position) {
+				stopped = true;
+				break;
+			}
+		}
+	}
+	return out;
 }
 
-#if !(__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
-template <typename CharT, CharT... charpack> CTRE_FLATTEN constexpr inline auto operator""_ctre_gen() noexcept {
-	constexpr auto & _input = _fixed_string_reference<CharT, charpack...>;
-#else
-template <ctll::fixed_string input> CTRE_FLATTEN constexpr inline auto operator""_ctre_gen() noexcept {
-	constexpr auto _input = input; // workaround for GCC 9 bug 88092
-#endif
-	using tmp = typename ctll::parser<ctre::pcre, _input, ctre::pcre_actions>::template output<pcre_context<>>;
-	static_assert(tmp(), "Regular Expression contains syntax error.");
-	return typename tmp::output_type::stack_type();
+template <typename Subject, typename RE, typename... Modifiers, typename Executor = thread_executor> auto parallel_range(const Subject & subject, regular_expression<RE, Modifiers...>, Executor && executor = Executor{}) {
+	const auto * begin = std::data(subject);
+	return parallel_search<RE, regular_expression<RE, Modifiers...>>(begin, begin + std::size(subject), executor);
 }
 
-#if !(__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
-template <typename CharT, CharT... charpack> CTRE_FLATTEN constexpr CTRE_FORCE_INLINE auto operator""_ctre_syntax() noexcept {
-	constexpr auto & _input = _fixed_string_reference<CharT, charpack...>;
+#if (__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
+template <ctll::fixed_string input, typename... Modifiers, typename Subject, typename Executor = thread_executor> auto parallel_range(const Subject & subject, Executor && executor = Executor{}) {
+	using re = typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type;
+	return parallel_range(subject, regular_expression<re, Modifiers...>(), executor);
+}
 #else
-template <ctll::fixed_string input> CTRE_FLATTEN constexpr CTRE_FORCE_INLINE auto operator""_ctre_syntax() noexcept {
-	constexpr auto _input = input; // workaround for GCC 9 bug 88092
-#endif
-	return ctll::parser<ctre::pcre, _input, ctre::pcre_actions>::template correct_with<pcre_context<>>;
+template <auto & input, typename... Modifiers, typename Subject, typename Executor = thread_executor> auto parallel_range(const Subject & subject, Executor && executor = Executor{}) {
+	using re = typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type;
+	return parallel_range(subject, regular_expression<re, Modifiers...>(), executor);
 }
-
-#endif
-
-#ifdef __clang__
-#pragma clang diagnostic pop
 #endif
 
-} // literals
-
-} // ctre
+}
 
 #endif
 
-#endif
+#ifndef CTRE__REPLACE__HPP
+#define CTRE__REPLACE__HPP
 
-#ifndef CTRE_V2__CTRE__FUNCTIONS__HPP
-#define CTRE_V2__CTRE__FUNCTIONS__HPP
+#include <algorithm>
+#include <iterator>
+#include <string>
 
 namespace ctre {
 
-#if !(__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
-// avoiding CTAD limitation in C++17
-template <typename CharT, size_t N> class pattern: public ctll::fixed_string<N> {
-	using parent = ctll::fixed_string<N>;
-public:
-	constexpr pattern(const CharT (&input)[N]) noexcept: parent(input) { }
-};
-
-template <typename CharT, size_t N> pattern(const CharT (&)[N]) -> pattern<CharT, N>;
+// replacement like `[$1] ${2} $$` parsed at compile-time into literal runs and capture references (`$0` is the whole match)
+template <size_t Id> struct replacement_capture { };
+template <typename... Pieces> struct replacement { };
+struct replacement_error { };
 
-// for better examples
-template <typename CharT, size_t N> class fixed_string: public ctll::fixed_string<N> {
-	using parent = ctll::fixed_string<N>;
-public:
-	constexpr fixed_string(const CharT (&input)[N]) noexcept: parent(input) { }
+struct replacement_reference {
+	size_t id;
+	size_t next; // position after the reference
+	bool correct;
 };
 
-template <typename CharT, size_t N> fixed_string(const CharT (&)[N]) -> fixed_string<CharT, N>;
-#endif
-
-#if (__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
-template <ctll::fixed_string input> CTRE_FLATTEN constexpr CTRE_FORCE_INLINE auto re() noexcept {
-constexpr auto _input = input; // workaround for GCC 9 bug 88092
-#else
-template <auto & input> CTRE_FLATTEN constexpr CTRE_FORCE_INLINE auto re() noexcept {	
-constexpr auto & _input = input; 
-#endif
-	
-	using tmp = typename ctll::parser<ctre::pcre, _input, ctre::pcre_actions>::template output<pcre_context<>>;
-	static_assert(tmp(), "Regular Expression contains syntax error.");
-	using re = decltype(front(typename tmp::output_type::stack_type()));
-	return ctre::regular_expression(re());
-}
-
-// in moment when we get C++20 support this will start to work :)
-
-template <typename RE> struct regex_match_t {
-	template <typename... Args> CTRE_FORCE_INLINE constexpr auto operator()(Args && ... args) const noexcept {
-		auto re_obj = ctre::regular_expression<RE>();
-		return re_obj.match(std::forward<Args>(args)...);
+// `n` or `{n}` after the `$`
+template <typename Format> constexpr replacement_reference read_replacement_reference(const Format & format, size_t position) noexcept {
+	const bool braces = position < format.size() && format[position] == '{';
+	size_t i = position + braces;
+	size_t id = 0;
+	for (; i < format.size() && format[i] >= '0' && format[i] <= '9'; ++i) {
+		if (id > (length_range::infinite - 9) / 10) return {0, i, false};
+		id = id * 10 + static_cast<size_t>(format[i] - '0');
 	}
-	template <typename... Args> CTRE_FORCE_INLINE constexpr auto try_extract(Args && ... args) const noexcept {
-		return operator()(std::forward<Args>(args)...);
+	const bool digits = i != position + braces;
+	if (braces) {
+		if (i >= format.size() || format[i] != '}') return {0, i, false};
+		++i;
 	}
-};
+	return {id, i, digits};
+}
 
-template <typename RE> struct regex_search_t {
-	template <typename... Args> CTRE_FORCE_INLINE constexpr auto operator()(Args && ... args) const noexcept {
-		auto re_obj = ctre::regular_expression<RE>();
-		return re_obj.search(std::forward<Args>(args)...);
-	}
-	template <typename... Args> CTRE_FORCE_INLINE constexpr auto try_extract(Args && ... args) const noexcept {
-		return operator()(std::forward<Args>(args)...);
-	}
-};
+template <typename... Pieces, typename Piece> constexpr auto push_replacement_piece(replacement<Pieces...>, Piece) noexcept {
+	return replacement<Pieces..., Piece>{};
+}
 
-#if (__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
+template <typename... Pieces> constexpr auto push_replacement_piece(replacement<Pieces...>, string<>) noexcept {
+	return replacement<Pieces...>{};
+}
 
-template <auto input> struct regex_builder {
-	static constexpr auto _input = input;
-	using _tmp = typename ctll::parser<ctre::pcre, _input, ctre::pcre_actions>::template output<pcre_context<>>;
-	static_assert(_tmp(), "Regular Expression contains syntax error.");
-	using type = ctll::conditional<(bool)(_tmp()), decltype(ctll::front(typename _tmp::output_type::stack_type())), ctll::list<reject>>;
-};
+template <const auto & Format, size_t Position, typename... Pieces, auto... Run> constexpr auto parse_replacement(replacement<Pieces...> done, string<Run...> run) noexcept {
+	if constexpr (Position >= Format.size()) {
+		return push_replacement_piece(done, run);
+	} else if constexpr (Format[Position] != '$') {
+		return parse_replacement<Format, Position + 1>(done, string<Run..., Format[Position]>{});
+	} else if constexpr (Position + 1 < Format.size() && Format[Position + 1] == '$') {
+		return parse_replacement<Format, Position + 2>(done, string<Run..., Format[Position]>{});
+	} else if constexpr (constexpr replacement_reference reference = read_replacement_reference(Format, Position + 1); reference.correct) {
+		using with_run = decltype(push_replacement_piece(done, run));
+		return parse_replacement<Format, reference.next>(decltype(push_replacement_piece(with_run{}, replacement_capture<reference.id>{})){}, string<>{});
+	} else {
+		return replacement_error{};
+	}
+}
 
-template <ctll::fixed_string input> static constexpr inline auto match = regex_match_t<typename regex_builder<input>::type>();
+template <typename T> constexpr size_t replacement_highest_capture(T) noexcept {
+	return 0;
+}
 
-template <ctll::fixed_string input> static constexpr inline auto search = regex_search_t<typename regex_builder<input>::type>();
+template <size_t Id> constexpr size_t replacement_highest_capture(replacement_capture<Id>) noexcept {
+	return Id;
+}
 
-#else
+template <typename... Pieces> constexpr size_t replacement_highest_capture(replacement<Pieces...>) noexcept {
+	return std::max<size_t>({size_t{0}, replacement_highest_capture(Pieces{})...});
+}
 
-template <auto & input> struct regex_builder {
-	using _tmp = typename ctll::parser<ctre::pcre, input, ctre::pcre_actions>::template output<pcre_context<>>;
-	static_assert(_tmp(), "Regular Expression contains syntax error.");
-	using type = ctll::conditional<(bool)(_tmp()), decltype(ctll::front(typename _tmp::output_type::stack_type())), ctll::list<reject>>;
+// where a capture can be in a match: the least distance from the match start and its length
+struct capture_placement {
+	bool found{false};
+	size_t offset{0};
+	length_range length{0, 0};
 };
 
-template <auto & input> static constexpr inline auto match = regex_match_t<typename regex_builder<input>::type>();
-
-template <auto & input> static constexpr inline auto search = regex_search_t<typename regex_builder<input>::type>();
-
-#endif
+template <size_t Id, typename... Content> constexpr capture_placement place_capture_sequence(ctll::list<Content...>) noexcept;
 
+template <size_t Id, typename T> constexpr capture_placement place_capture(T) noexcept {
+	return {};
 }
 
-#endif
-
-#ifndef CTRE_V2__CTRE__ITERATOR__HPP
-#define CTRE_V2__CTRE__ITERATOR__HPP
+// sequences, loops, lookaheads (captures inside them are still at least as far as their first iteration)
+template <size_t Id, template <typename...> typename Node, typename... Content> constexpr capture_placement place_capture(Node<Content...>) noexcept {
+	return place_capture_sequence<Id>(ctll::list<Content...>{});
+}
 
-namespace ctre {
+template <size_t Id, size_t A, size_t B, typename... Content> constexpr capture_placement place_capture(repeat<A, B, Content...>) noexcept {
+	return place_capture_sequence<Id>(ctll::list<Content...>{});
+}
 
-struct regex_end_iterator {
-	constexpr regex_end_iterator() noexcept { }
-};
+template <size_t Id, size_t A, size_t B, typename... Content> constexpr capture_placement place_capture(lazy_repeat<A, B, Content...>) noexcept {
+	return place_capture_sequence<Id>(ctll::list<Content...>{});
+}
 
-template <typename BeginIterator, typename EndIterator, typename RE> struct regex_iterator {
-	BeginIterator current;
-	const EndIterator end;
-	decltype(RE::search_2(std::declval<BeginIterator>(), std::declval<EndIterator>())) current_match;
+template <size_t Id, size_t A, size_t B, typename... Content> constexpr capture_placement place_capture(possessive_repeat<A, B, Content...>) noexcept {
+	return place_capture_sequence<Id>(ctll::list<Content...>{});
+}
 
-	constexpr regex_iterator(BeginIterator begin, EndIterator end) noexcept: current{begin}, end{end}, current_match{RE::search_2(current, end)} {
-		if (current_match) {
-			current = current_match.template get<0>().end();
-		}
-	}
-	constexpr const auto & operator*() const noexcept {
-		return current_match;
+template <size_t Id, size_t Current, typename... Content> constexpr capture_placement place_capture(capture<Current, Content...>) noexcept {
+	if constexpr (Id == Current) {
+		return {true, 0, pattern_length(sequence<Content...>{})};
+	} else {
+		return place_capture_sequence<Id>(ctll::list<Content...>{});
 	}
-	constexpr regex_iterator & operator++() noexcept {
-		current_match = RE::search_2(current, end);
-		if (current_match) {
-			current = current_match.template get<0>().end();
-		}
-		return *this;
+}
+
+template <size_t Id, size_t Current, typename Name, typename... Content> constexpr capture_placement place_capture(capture_with_name<Current, Name, Content...>) noexcept {
+	if constexpr (Id == Current) {
+		return {true, 0, pattern_length(sequence<Content...>{})};
+	} else {
+		return place_capture_sequence<Id>(ctll::list<Content...>{});
 	}
-	constexpr regex_iterator operator++(int) noexcept {
-		auto previous = *this;
-		current_match = RE::search_2(current, end);
-		if (current_match) {
-			current = current_match.template get<0>().end();
+}
+
+template <size_t Id, typename... Opts> constexpr capture_placement place_capture(select<Opts...>) noexcept {
+	const capture_placement options[] = {place_capture<Id>(Opts{})..., capture_placement{}};
+	capture_placement out{};
+	for (const capture_placement & option: options) {
+		if (!option.found) continue;
+		if (!out.found) {
+			out = option;
+		} else {
+			out.offset = std::min(out.offset, option.offset);
+			out.length = {std::min(out.length.min, option.length.min), std::max(out.length.max, option.length.max)};
 		}
-		return previous;
 	}
-};
-
-template <typename BeginIterator, typename EndIterator, typename RE> constexpr bool operator!=(const regex_iterator<BeginIterator, EndIterator, RE> & left, regex_end_iterator) {
-	return bool(left.current_match);
+	return out;
 }
 
-template <typename BeginIterator, typename EndIterator, typename RE> constexpr bool operator!=(regex_end_iterator, const regex_iterator<BeginIterator, EndIterator, RE> & right) {
-	return bool(right.current_match);
+template <size_t Id, typename... Content> constexpr capture_placement place_capture_sequence(ctll::list<Content...>) noexcept {
+	const capture_placement inner[] = {place_capture<Id>(Content{})..., capture_placement{}};
+	const length_range lengths[] = {pattern_length(Content{})..., length_range{0, 0}};
+	size_t offset = 0;
+	for (size_t i = 0; i != sizeof...(Content); ++i) {
+		if (inner[i].found) {
+			return {true, saturated_add(offset, inner[i].offset), inner[i].length};
+		}
+		offset = saturated_add(offset, lengths[i].min);
+	}
+	return {};
 }
 
-template <typename BeginIterator, typename EndIterator, typename RE> constexpr auto iterator(BeginIterator begin, EndIterator end, RE) noexcept {
-	return regex_iterator<BeginIterator, EndIterator, RE>(begin, end);
-}
+// what a piece reads and the most code units it writes (a non-ASCII character can take up to four)
+struct replacement_piece_reach {
+	bool reads;
+	capture_placement source;
+	size_t written;
+};
 
-constexpr auto iterator() noexcept {
-	return regex_end_iterator{};
+template <typename Pattern, auto... Str> constexpr replacement_piece_reach replacement_piece(string<Str...>) noexcept {
+	return {false, {}, ((static_cast<uint32_t>(Str) < 0x80 ? size_t{1} : size_t{4}) + ... + size_t{0})};
 }
 
-template <typename Subject, typename RE> constexpr auto iterator(const Subject & subject, RE re) noexcept {
-	return iterator(subject.begin(), subject.end(), re);
+template <typename Pattern, size_t Id> constexpr replacement_piece_reach replacement_piece(replacement_capture<Id>) noexcept {
+	if constexpr (Id == 0) {
+		return {true, {true, 0, pattern_length(Pattern{})}, pattern_length(Pattern{}).max};
+	} else {
+		constexpr capture_placement source = place_capture<Id>(Pattern{});
+		return {true, source, source.length.max};
+	}
 }
 
-#if (__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
-template <ctll::fixed_string input, typename BeginIterator, typename EndIterator> CTRE_FLATTEN constexpr CTRE_FORCE_INLINE auto iterator(BeginIterator begin, EndIterator end) noexcept {
-	constexpr auto _input = input;
-	using tmp = typename ctll::parser<ctre::pcre, _input, ctre::pcre_actions>::template output<pcre_context<>>;
-	static_assert(tmp(), "Regular Expression contains syntax error.");
-	using re = decltype(front(typename tmp::output_type::stack_type()));
-	return iterator(begin, end, re());
+// the output can be the subject itself if it never overtakes what is still to be read:
+// every capture is read before anything is written over it, a replacement is never longer than its match
+// and no multiline `^` looks at the character before the match (it can be already replaced)
+template <typename Pattern, typename... Pieces> constexpr bool replaces_in_place(replacement<Pieces...>) noexcept {
+	if (pattern_reach(Pattern{}).preceding) {
+		return false;
+	}
+	const replacement_piece_reach pieces[] = {replacement_piece<Pattern>(Pieces{})..., replacement_piece_reach{false, {}, 0}};
+	size_t written = 0;
+	for (size_t i = 0; i != sizeof...(Pieces); ++i) {
+		if (pieces[i].reads && (!pieces[i].source.found || written > pieces[i].source.offset)) {
+			return false;
+		}
+		written = saturated_add(written, pieces[i].written);
+	}
+	return written <= pattern_length(Pattern{}).min;
 }
-#endif
 
-#if (__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
-template <ctll::fixed_string input, typename Subject> CTRE_FLATTEN constexpr CTRE_FORCE_INLINE auto iterator(const Subject & subject) noexcept {
-	constexpr auto _input = input;
-	using tmp = typename ctll::parser<ctre::pcre, _input, ctre::pcre_actions>::template output<pcre_context<>>;
-	static_assert(tmp(), "Regular Expression contains syntax error.");
-	using re = decltype(front(typename tmp::output_type::stack_type()));
-	return iterator(subject.begin(), subject.end(), re());
+template <typename Pattern> constexpr bool replaces_in_place(replacement_error) noexcept {
+	return false;
 }
-#endif
 
-} // ctre
+// writing
 
+template <typename CharT, typename Out> constexpr CTRE_FORCE_INLINE Out write_code_point(Out out, char32_t value) {
+	if constexpr (sizeof(CharT) == 1) {
+#if CTRE_STRING_IS_UTF8
+		const bool encode = value >= 0x80;
+#else
+		const bool encode = value > 0xFF;
 #endif
+		if (encode) {
+			if (value < 0x800) {
+				*out = static_cast<CharT>(0xC0 | (value >> 6)); ++out;
+			} else if (value < 0x10000) {
+				*out = static_cast<CharT>(0xE0 | (value >> 12)); ++out;
+				*out = static_cast<CharT>(0x80 | ((value >> 6) & 0x3F)); ++out;
+			} else {
+				*out = static_cast<CharT>(0xF0 | (value >> 18)); ++out;
+				*out = static_cast<CharT>(0x80 | ((value >> 12) & 0x3F)); ++out;
+				*out = static_cast<CharT>(0x80 | ((value >> 6) & 0x3F)); ++out;
+			}
+			*out = static_cast<CharT>(0x80 | (value & 0x3F)); ++out;
+			return out;
+		}
+	} else if constexpr (sizeof(CharT) == 2) {
+		if (value > 0xFFFF) {
+			*out = static_cast<CharT>(0xD800 | ((value - 0x10000) >> 10)); ++out;
+			*out = static_cast<CharT>(0xDC00 | ((value - 0x10000) & 0x3FF)); ++out;
+			return out;
+		}
+	}
+	*out = static_cast<CharT>(value);
+	++out;
+	return out;
+}
 
-#ifndef CTRE_V2__CTRE__RANGE__HPP
-#define CTRE_V2__CTRE__RANGE__HPP
+template <typename CharT, typename Results, typename Out, auto... Str> constexpr CTRE_FORCE_INLINE Out write_replacement_piece(const Results &, Out out, string<Str...>) {
+	((out = write_code_point<CharT>(out, static_cast<char32_t>(Str))), ...);
+	return out;
+}
 
-namespace ctre {
+// output of the string returning replace, which appends whole runs instead of pushing characters one by one
+template <typename CharT> struct replacement_appender {
+	std::basic_string<CharT> * target;
 
-template <typename BeginIterator, typename EndIterator, typename RE> struct regex_range {
-	BeginIterator _begin;
-	const EndIterator _end;
-	constexpr regex_range(BeginIterator begin, EndIterator end) noexcept: _begin{begin}, _end{end} { }
-	
-	constexpr auto begin() const noexcept {
-		return regex_iterator<BeginIterator, EndIterator, RE>(_begin, _end);
+	constexpr replacement_appender & operator*() noexcept {
+		return *this;
 	}
-	constexpr auto end() const noexcept {
-		return regex_end_iterator{};
+	constexpr replacement_appender & operator++() noexcept {
+		return *this;
+	}
+	replacement_appender & operator=(CharT c) {
+		target->push_back(c);
+		return *this;
 	}
 };
 
-template <typename BeginIterator, typename EndIterator, typename RE> constexpr auto range(BeginIterator begin, EndIterator end, RE) noexcept {
-	return regex_range<BeginIterator, EndIterator, RE>(begin, end);
+template <typename Iterator, typename Out> constexpr CTRE_FORCE_INLINE Out copy_replaced(Iterator first, Iterator last, Out out) {
+	return std::copy(first, last, out);
 }
 
-#if (__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
-template <ctll::fixed_string input, typename BeginIterator, typename EndIterator> constexpr auto range(BeginIterator begin, EndIterator end) noexcept {
-	constexpr auto _input = input;
-	using tmp = typename ctll::parser<ctre::pcre, _input, ctre::pcre_actions>::template output<pcre_context<>>;
-	static_assert(tmp(), "Regular Expression contains syntax error.");
-	using re = decltype(front(typename tmp::output_type::stack_type()));
-	auto re_obj = ctre::regular_expression(re());
-	return range(begin, end, re_obj);
+template <typename Iterator, typename CharT> CTRE_FORCE_INLINE replacement_appender<CharT> copy_replaced(Iterator first, Iterator last, replacement_appender<CharT> out) {
+	out.target->append(first, last);
+	return out;
 }
-#endif
 
-template <typename Subject, typename RE> constexpr auto range(const Subject & subject, RE re) noexcept {
-	return range(subject.begin(), subject.end(), re);
+template <typename CharT, typename Results, typename Out, size_t Id> constexpr CTRE_FORCE_INLINE Out write_replacement_piece(const Results & results, Out out, replacement_capture<Id>) {
+	const auto & captured = results.template get<Id>();
+	if (!captured) {
+		return out;
+	}
+	return copy_replaced(captured.begin(), captured.end(), out);
 }
 
-template <typename RE> constexpr auto range(const char * subject, RE re) noexcept {
-	return range(subject, zero_terminated_string_end_iterator(), re);
+// every match replaced in one pass, the text between them is copied as it is and `^` matches only at the beginning of the subject
+// (or of its lines with multiline), not after a replaced match; as in std::regex_replace and PCRE a non-empty match is tried
+// where an empty one was found and if there is none the next character is copied
+template <typename RE, typename... Pieces, typename Iterator, typename EndIterator, typename Out> constexpr Out replace_all(const Iterator begin, const EndIterator end, Out out, replacement<Pieces...>) {
+	using char_type = std::remove_cv_t<std::remove_reference_t<decltype(*begin)>>;
+	Iterator current = begin;
+	while (true) {
+		const auto result = RE::search_2(begin, current, end);
+		if (!result) {
+			break;
+		}
+		const auto match = result.template get<0>();
+		out = copy_replaced(current, match.begin(), out);
+		((out = write_replacement_piece<char_type>(result, out, Pieces{})), ...);
+		current = match.end();
+		if (match.begin() == match.end()) {
+			if (end == current) {
+				return out;
+			}
+			if (const auto retried = RE::non_empty_starts_with_2(begin, current, end)) {
+				((out = write_replacement_piece<char_type>(retried, out, Pieces{})), ...);
+				current = retried.template get<0>().end();
+			} else {
+				*out = *current;
+				++out;
+				++current;
+			}
+		}
+	}
+	if constexpr (std::is_same_v<Iterator, EndIterator>) {
+		return copy_replaced(current, end, out);
+	} else {
+		for (; end != current; ++current) {
+			*out = *current;
+			++out;
+		}
+		return out;
+	}
 }
 
+template <typename Pattern, typename Replacement, typename... Modifiers> struct regex_replace_t {
+	static_assert(!std::is_same_v<Replacement, replacement_error>, "Replacement contains syntax error (use $n, ${n} or $$).");
+	static_assert(replacement_highest_capture(Replacement{}) <= ctll::size(find_captures(Pattern{})), "Replacement refers to a capture the pattern doesn't have.");
+	using RE = regular_expression<Pattern, Modifiers...>;
+
+	// into any output iterator (or a buffer as big as the subject, the same as the subject if in_place)
+	template <typename Iterator, typename EndIterator, typename Out> constexpr CTRE_FORCE_INLINE Out operator()(Iterator begin, EndIterator end, Out out) const {
+		return replace_all<RE>(begin, end, out, Replacement{});
+	}
+	template <typename Range, typename Out, typename = std::enable_if_t<RangeLikeType<Range>::value>> constexpr CTRE_FORCE_INLINE Out operator()(const Range & subject, Out out) const {
+		return replace_all<RE>(std::begin(subject), std::end(subject), out, Replacement{});
+	}
+	// new string reserved for the subject's size (it's all it needs when in_place)
+	template <typename Range, typename = std::enable_if_t<RangeLikeType<Range>::value>> auto operator()(const Range & subject) const {
+		using char_type = std::remove_cv_t<std::remove_reference_t<decltype(*std::begin(subject))>>;
+		std::basic_string<char_type> out;
+		out.reserve(static_cast<size_t>(std::distance(std::begin(subject), std::end(subject))));
+		replace_all<RE>(std::begin(subject), std::end(subject), replacement_appender<char_type>{&out}, Replacement{});
+		return out;
+	}
+
+	static constexpr bool in_place = replaces_in_place<Pattern>(Replacement{});
+};
+
+// rewrites a container with contiguous storage (like std::string) and shrinks it to the result
+template <typename Pattern, typename Replacement, typename... Modifiers> struct regex_replace_in_place_t {
+	static_assert(regex_replace_t<Pattern, Replacement, Modifiers...>::in_place, "Replacement can be longer than its match, overwrite a capture before it's used or a character multiline `^` looks at, it can't be done in place.");
+	using RE = regular_expression<Pattern, Modifiers...>;
+
+	template <typename Container> CTRE_FORCE_INLINE size_t operator()(Container & subject) const noexcept {
+		auto * const begin = std::data(subject);
+		auto * const end = replace_all<RE>(begin, begin + std::size(subject), begin, Replacement{});
+		const auto size = static_cast<size_t>(end - begin);
+		subject.resize(size);
+		return size;
+	}
+};
+
 #if (__cpp_nontype_template_parameter_class || (__cpp_nontype_template_args >= 201911L))
-template <ctll::fixed_string input, typename Subject> constexpr auto range(const Subject & subject) noexcept {
-	constexpr auto _input = input;
-	using tmp = typename ctll::parser<ctre::pcre, _input, ctre::pcre_actions>::template output<pcre_context<>>;
-	static_assert(tmp(), "Regular Expression contains syntax error.");
-	using re = decltype(front(typename tmp::output_type::stack_type()));
-	auto re_obj = ctre::regular_expression(re());
-	return range(subject.begin(), subject.end(), re_obj);
-}
+template <auto format> struct replacement_builder {
+	static constexpr auto _format = format;
+	using type = decltype(parse_replacement<_format, 0>(replacement<>{}, string<>{}));
+};
+
+template <ctll::fixed_string input, ctll::fixed_string format, typename... Modifiers> static constexpr inline auto replace = regex_replace_t<typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type, typename replacement_builder<format>::type, Modifiers...>();
+
+template <ctll::fixed_string input, ctll::fixed_string format, typename... Modifiers> static constexpr inline auto replace_in_place = regex_replace_in_place_t<typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type, typename replacement_builder<format>::type, Modifiers...>();
 #else
-template <auto & input, typename Subject> constexpr auto range(const Subject & subject) noexcept {
-	constexpr auto & _input = input;
-	using tmp = typename ctll::parser<ctre::pcre, _input, ctre::pcre_actions>::template output<pcre_context<>>;
-	static_assert(tmp(), "Regular Expression contains syntax error.");
-	using re = decltype(front(typename tmp::output_type::stack_type()));
-	auto re_obj = ctre::regular_expression(re());
-	return range(subject.begin(), subject.end(), re_obj);
-}
+template <auto & format> struct replacement_builder {
+	using type = decltype(parse_replacement<format, 0>(replacement<>{}, string<>{}));
+};
+
+template <auto & input, auto & format, typename... Modifiers> static constexpr inline auto replace = regex_replace_t<typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type, typename replacement_builder<format>::type, Modifiers...>();
+
+template <auto & input, auto & format, typename... Modifiers> static constexpr inline auto replace_in_place = regex_replace_in_place_t<typename regex_builder<input, is_case_insensitive_v<Modifiers...>, is_multiline_v<Modifiers...>>::type, typename replacement_builder<format>::type, Modifiers...>();
 #endif
 
 }
@@ -0,0 +1,383 @@
+// line oriented grep for a fixed set of compiled-in patterns:
+//   ctre_grep [-p name] [-c] [-s] file...   (no file or "-" reads stdin)
+// prints matching lines (prefixed with the file name if there are more files),
+// -c prints only counts, -s reports throughput on stderr, exit status is 0 (match), 1 (no match) or 2 (error)
+// files are mapped into memory, pipes (and everything else which can't be mapped) are read in blocks of whole lines
+
+#include "ctre.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace {
+
+static constexpr auto error_pattern = ctll::fixed_string{"ERROR|FATAL|panic"};
+static constexpr auto timestamp_pattern = ctll::fixed_string{"[0-9]{4}-[0-9]{2}-[0-9]{2}[T ][0-9]{2}:[0-9]{2}:[0-9]{2}"};
+static constexpr auto ipv4_pattern = ctll::fixed_string{"[0-9]{1,3}\\.[0-9]{1,3}\\.[0-9]{1,3}\\.[0-9]{1,3}"};
+static constexpr auto utc_pattern = ctll::fixed_string{"UTC([\\+\\-])(\\d\\d?)(:?(\\d\\d))?"};
+// searched in multiline mode, its sets exclude '\n' so the whole input can be searched at once
+static constexpr auto status_pattern = ctll::fixed_string{"^\\S+ \\S+ \\S+ \\[[^\\]\\n]*\\] \"[^\"\\n]*\" 5[0-9][0-9] "};
+
+#ifdef IOV_MAX
+constexpr size_t max_iovecs = IOV_MAX;
+#else
+constexpr size_t max_iovecs = 1024;
+#endif
+
+// matching lines are written straight from the mapped input, so the pieces are collected and written with writev
+class output {
+    std::vector<iovec> pieces;
+    bool failed = false;
+
+public:
+    output() {
+        pieces.reserve(max_iovecs);
+    }
+
+    void add(const char * data, size_t size) {
+        if (size == 0) {
+            return;
+        }
+        if (pieces.size() == max_iovecs) {
+            flush();
+        }
+        pieces.push_back(iovec{const_cast<char *>(data), size});
+    }
+
+    void add(std::string_view text) {
+        add(text.data(), text.size());
+    }
+
+    // has to be called before the memory of the pieces goes away
+    void flush() {
+        size_t first = 0;
+        while (first != pieces.size() && !failed) {
+            const int count = static_cast<int>(std::min(pieces.size() - first, max_iovecs));
+            const ssize_t written = writev(STDOUT_FILENO, pieces.data() + first, count);
+            if (written < 0) {
+                failed = (errno != EINTR);
+                continue;
+            }
+            // partially written piece stays for the next writev
+            size_t rest = static_cast<size_t>(written);
+            while (first != pieces.size() && rest >= pieces[first].iov_len) {
+                rest -= pieces[first].iov_len;
+                ++first;
+            }
+            if (rest != 0) {
+                pieces[first].iov_base = static_cast<char *>(pieces[first].iov_base) + rest;
+                pieces[first].iov_len -= rest;
+            }
+        }
+        pieces.clear();
+    }
+
+    bool ok() const {
+        return !failed;
+    }
+};
+
+// last '\n' in [first, last) or nullptr (memrchr is a GNU extension)
+const char * find_last_newline(const char * first, const char * last) {
+    const auto found = std::find(std::make_reverse_iterator(last), std::make_reverse_iterator(first), '\n');
+    return (found.base() != first) ? std::prev(found.base()) : nullptr;
+}
+
+struct options {
+    bool count = false;
+    bool prefix = false;
+};
+
+// patterns which can't see a line boundary are searched over the whole input (and the line is found around the match),
+// the others (`^`, `$` or matching '\n') are tried on every line separately,
+// multiline `^` is fine over the whole input as every search starts at the beginning of a line
+template <auto & Pattern, typename... Modifiers> size_t scan(std::string_view name, const char * begin, const char * end, output & out, const options & opts) {
+    using pattern_type = typename ctre::regex_builder<Pattern, false, ctre::is_multiline_v<Modifiers...>>::type;
+    constexpr ctre::match_reach reach = ctre::pattern_reach(pattern_type{});
+    constexpr bool within_line = (!reach.search_begin || ctre::is_multiline_v<Modifiers...>) && !reach.subject_end && !reach.newline;
+
+    size_t matched = 0;
+    const auto emit = [&](const char * line, const char * line_end) {
+        ++matched;
+        if (opts.count) {
+            return;
+        }
+        if (opts.prefix) {
+            out.add(name);
+            out.add(":");
+        }
+        if (line_end != end) {
+            out.add(line, static_cast<size_t>(line_end - line) + 1);
+        } else {
+            out.add(line, static_cast<size_t>(line_end - line));
+            out.add("\n");
+        }
+    };
+
+    if constexpr (within_line) {
+        for (const char * current = begin; current < end;) {
+            const auto result = ctre::search<Pattern, Modifiers...>(current, end);
+            if (!result) {
+                break;
+            }
+            const char * const match = result.template get<0>().begin();
+            const char * const previous = find_last_newline(current, match);
+            const char * const line = previous ? previous + 1 : current;
+            const void * const next = std::memchr(match, '\n', static_cast<size_t>(end - match));
+            const char * const line_end = next ? static_cast<const char *>(next) : end;
+            emit(line, line_end);
+            if (line_end == end) {
+                break;
+            }
+            current = line_end + 1;
+        }
+    } else {
+        for (const char * line = begin; line < end;) {
+            const void * const next = std::memchr(line, '\n', static_cast<size_t>(end - line));
+            const char * const line_end = next ? static_cast<const char *>(next) : end;
+            if (ctre::search<Pattern, Modifiers...>(line, line_end)) {
+                emit(line, line_end);
+            }
+            if (line_end == end) {
+                break;
+            }
+            line = line_end + 1;
+        }
+    }
+    return matched;
+}
+
+using scan_function = size_t (*)(std::string_view, const char *, const char *, output &, const options &);
+
+template <const auto & Pattern> std::string source_of() {
+    std::string out;
+    for (const char32_t c : Pattern) {
+        out += static_cast<char>(c);
+    }
+    return out;
+}
+
+struct compiled_pattern {
+    std::string_view name;
+    scan_function scan;
+    std::string (*source)();
+};
+
+const compiled_pattern PATTERNS[] = {
+    {"error", &scan<error_pattern>, &source_of<error_pattern>},
+    {"timestamp", &scan<timestamp_pattern>, &source_of<timestamp_pattern>},
+    {"ipv4", &scan<ipv4_pattern>, &source_of<ipv4_pattern>},
+    {"utc", &scan<utc_pattern>, &source_of<utc_pattern>},
+    {"http5xx", &scan<status_pattern, ctre::multiline>, &source_of<status_pattern>},
+};
+
+// file mapped into memory (nothing is mapped for pipes and other special files)
+class mapping {
+    const char * data = nullptr;
+    size_t size = 0;
+
+public:
+    mapping(const mapping &) = delete;
+    mapping & operator=(const mapping &) = delete;
+
+    explicit mapping(int fd) {
+        struct stat info;
+        if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size <= 0) {
+            return;
+        }
+        void * memory = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (memory == MAP_FAILED) {
+            return;
+        }
+        data = static_cast<const char *>(memory);
+        size = static_cast<size_t>(info.st_size);
+        madvise(memory, size, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+        madvise(memory, size, MADV_HUGEPAGE);
+#endif
+    }
+
+    ~mapping() {
+        if (data) {
+            munmap(const_cast<char *>(data), size);
+        }
+    }
+
+    bool mapped() const {
+        return data != nullptr;
+    }
+
+    const char * begin() const {
+        return data;
+    }
+
+    const char * end() const {
+        return data + size;
+    }
+};
+
+struct scan_result {
+    size_t matched = 0;
+    size_t bytes = 0;
+    // errno of a failed read
+    int error = 0;
+};
+
+constexpr size_t block_size = size_t{1} << 20;
+
+// only whole lines of a block are scanned, the unfinished one is moved to the front for the next read
+// (the buffer grows when a line doesn't fit into it)
+scan_result scan_blocks(int fd, const compiled_pattern & pattern, std::string_view name, output & out, const options & opts) {
+    scan_result result;
+    std::vector<char> buffer(block_size);
+    size_t kept = 0;
+    for (;;) {
+        if (kept == buffer.size()) {
+            buffer.resize(buffer.size() * 2);
+        }
+        const ssize_t got = read(fd, buffer.data() + kept, buffer.size() - kept);
+        if (got < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            result.error = errno;
+            break;
+        }
+        if (got == 0) {
+            break;
+        }
+        result.bytes += static_cast<size_t>(got);
+        const char * const begin = buffer.data();
+        const char * const newline = find_last_newline(begin + kept, begin + kept + got);
+        kept += static_cast<size_t>(got);
+        if (!newline) {
+            continue;
+        }
+        const char * const lines_end = newline + 1;
+        result.matched += pattern.scan(name, begin, lines_end, out, opts);
+        // pieces point into the buffer
+        out.flush();
+        kept -= static_cast<size_t>(lines_end - begin);
+        std::memmove(buffer.data(), lines_end, kept);
+    }
+    if (kept != 0) {
+        result.matched += pattern.scan(name, buffer.data(), buffer.data() + kept, out, opts);
+        out.flush();
+    }
+    return result;
+}
+
+scan_result scan_file(int fd, const compiled_pattern & pattern, std::string_view name, output & out, const options & opts) {
+    const mapping input(fd);
+    if (!input.mapped()) {
+        return scan_blocks(fd, pattern, name, out, opts);
+    }
+    scan_result result;
+    result.matched = pattern.scan(name, input.begin(), input.end(), out, opts);
+    result.bytes = static_cast<size_t>(input.end() - input.begin());
+    // pieces point into the mapping
+    out.flush();
+    return result;
+}
+
+void usage() {
+    std::fprintf(stderr, "usage: ctre_grep [-p name] [-c] [-s] [file...]\npatterns:\n");
+    for (const auto & pattern : PATTERNS) {
+        std::fprintf(stderr, "  %-10.*s %s\n", static_cast<int>(pattern.name.size()), pattern.name.data(), pattern.source().c_str());
+    }
+}
+
+} // namespace
+
+int main(int argc, char ** argv)
+{
+    const compiled_pattern * pattern = &PATTERNS[0];
+    options opts;
+    bool stats = false;
+    std::vector<const char *> files;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "-p" && i + 1 < argc) {
+            const std::string_view name = argv[++i];
+            pattern = nullptr;
+            for (const auto & candidate : PATTERNS) {
+                if (candidate.name == name) {
+                    pattern = &candidate;
+                }
+            }
+            if (!pattern) {
+                usage();
+                return 2;
+            }
+        } else if (arg == "-c") {
+            opts.count = true;
+        } else if (arg == "-s") {
+            stats = true;
+        } else if (arg == "-h" || arg == "--help") {
+            usage();
+            return 0;
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+    if (files.empty()) {
+        files.push_back("-");
+    }
+    opts.prefix = files.size() > 1;
+
+    output out;
+    size_t total_matched = 0;
+    size_t total_bytes = 0;
+    bool error = false;
+    const auto start = std::chrono::steady_clock::now();
+
+    for (const char * file : files) {
+        const std::string_view name = file;
+        const int fd = (name == "-") ? STDIN_FILENO : open(file, O_RDONLY);
+        if (fd < 0) {
+            std::fprintf(stderr, "ctre_grep: %s: %s\n", file, std::strerror(errno));
+            error = true;
+            continue;
+        }
+        const scan_result result = scan_file(fd, *pattern, name, out, opts);
+        total_matched += result.matched;
+        total_bytes += result.bytes;
+        if (result.error != 0) {
+            std::fprintf(stderr, "ctre_grep: %s: %s\n", file, std::strerror(result.error));
+            error = true;
+        } else if (opts.count) {
+            std::string line = opts.prefix ? std::string(name) + ":" : std::string();
+            line += std::to_string(result.matched) + "\n";
+            out.add(line);
+            // the piece points into the line
+            out.flush();
+        }
+        if (fd != STDIN_FILENO) {
+            close(fd);
+        }
+    }
+
+    if (stats) {
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::fprintf(stderr, "ctre_grep: %zu bytes, %zu lines matched, %.3f s, %.2f GB/s\n", total_bytes, total_matched, seconds, seconds > 0 ? static_cast<double>(total_bytes) / seconds / 1e9 : 0.0);
+    }
+    if (!out.ok()) {
+        return 2;
+    }
+    return error ? 2 : (total_matched ? 0 : 1);
+}
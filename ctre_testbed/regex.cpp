@@ -5,6 +5,7 @@
 #include <utility>
 #include <string_view>
 #include <sstream>
+#include <string>
 
 namespace {
 const std::vector<std::pair<std::string, int>> TEST_STRINGS = {
@@ -32,8 +33,18 @@ const std::vector<std::pair<std::string, int>> TEST_STRINGS = {
     {"2008-10-13 UTC+01:0011.50", 3600},
     {"2008-10-13 UTC+01:011.50", 3660},
 };
+
+const std::vector<std::string> ENGINE_TEST_STRINGS = {
+    "", "a", "b", "ab", "aab", "abb", "abcd", "xabcd", "bab", "aabbx", "cab", "abc\nb",
+};
 }
 
+// patterns the engines are checked with: anchors, empty matches and captures
+static constexpr auto anchored = ctll::fixed_string{"^(a+)(b*)$"};
+static constexpr auto maybe_empty = ctll::fixed_string{"(a*)(b?)"};
+static constexpr auto alternatives = ctll::fixed_string{"(a|ab)(c|bcd)?"};
+static constexpr auto at_end = ctll::fixed_string{"(b|c)$"};
+
 constexpr char32_t pattern_string[] = U".*UTC([\\+\\-])(\\d\\d?)(:?(\\d\\d))?.*";
 constexpr size_t size = sizeof(pattern_string) / sizeof(pattern_string[0]);
 static constexpr auto pattern = ctll::fixed_string<size>{ pattern_string };
@@ -68,6 +79,52 @@ int getUtcOffset(std::string_view input) {
     return offset;
 }
 
+template <typename Expected, typename Got> bool same_capture(const Expected & expected, const Got & got) {
+    if (bool(expected) != bool(got)) {
+        return false;
+    }
+    return !expected || (expected.begin() == got.begin() && expected.end() == got.end());
+}
+
+template <typename Expected, typename Got, size_t... Id> bool same_captures(const Expected & expected, const Got & got, std::index_sequence<Id...>) {
+    return (same_capture(expected.template get<Id>(), got.template get<Id>()) && ...);
+}
+
+// an engine gives the same results as backtracking (the dfa ones only say if and where the match starts, a search finds the longest one)
+template <auto & Pattern, typename Engine, bool LeftmostLongest> bool same_as_backtracking(std::string_view input) {
+    const auto expected_match = ctre::match<Pattern>(input);
+    const auto got_match = ctre::match<Pattern, Engine>(input);
+    const auto expected_search = ctre::search<Pattern>(input);
+    const auto got_search = ctre::search<Pattern, Engine>(input);
+    if constexpr (LeftmostLongest) {
+        return bool(expected_match) == bool(got_match) && bool(expected_search) == bool(got_search)
+            && (!expected_search || expected_search.template get<0>().begin() == got_search.template get<0>().begin());
+    } else {
+        constexpr auto captures = std::make_index_sequence<decltype(expected_match)::size()>();
+        return same_captures(expected_match, got_match, captures) && same_captures(expected_search, got_search, captures);
+    }
+}
+
+template <auto & Pattern, typename Engine, bool LeftmostLongest = false> void check_engine(const char * engine) {
+    std::stringstream ss;
+    ss << "OK.";
+    for (const auto & input : ENGINE_TEST_STRINGS) {
+        if (!same_as_backtracking<Pattern, Engine, LeftmostLongest>(input)) {
+            ss.str("");
+            ss << "FAIL. Differs from backtracking on \"" << input << "\"";
+            break;
+        }
+    }
+    std::cout << "ENGINE_TEST[" << engine << " " << std::string(Pattern.begin(), Pattern.end()) << "]: " << ss.str() << std::endl;
+}
+
+template <auto & Pattern> void check_engines() {
+    check_engine<Pattern, ctre::memoized_backtracking>("memoized_backtracking");
+    check_engine<Pattern, ctre::pike_vm>("pike_vm");
+    check_engine<Pattern, ctre::dfa, true>("dfa");
+    check_engine<Pattern, ctre::lazy_dfa, true>("lazy_dfa");
+}
+
 int main()
 {
     for (const auto& s : TEST_STRINGS) {
@@ -87,5 +144,10 @@ int main()
             std::cout << "REGEX_TEST[" << input << "]: " << ss.str() << std::endl;
         }
     }
+
+    check_engines<anchored>();
+    check_engines<maybe_empty>();
+    check_engines<alternatives>();
+    check_engines<at_end>();
     return 0;
 }
@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+# Regenerates the general category tables of ctre.hpp (category_stage1/2/3 in CTRE__ATOMS_UNICODE__HPP).
+#
+#   gen_categories.py [--check] [source] [header]
+#
+# source is DerivedGeneralCategory.txt (default, the pinned copy next to this script)
+# or UnicodeData.txt of the same version, header is ../ctre.hpp by default;
+# --check only tells if the header already contains the tables.
+
+import os
+import re
+import sys
+
+VERSION = "14.0.0"
+
+# order of ctre::uni::category
+CATEGORIES = "Lu Ll Lt Lm Lo Mn Mc Me Nd Nl No Pc Pd Ps Pe Pi Pf Po Sm Sc Sk So Zs Zl Zp Cc Cf Cs Co Cn".split()
+
+CODE_POINTS = 0x110000
+LEAF = 32    # code points in a leaf block (stage3)
+MIDDLE = 32  # leaf blocks in a middle block (stage2)
+
+
+def read_unicode_data(lines):
+    # code;name;category;... with <..., First>/<..., Last> pairs for ranges
+    cats = {}
+    first = None
+    for line in lines:
+        fields = line.split(";")
+        cp, name, category = int(fields[0], 16), fields[1], fields[2]
+        if name.endswith(", First>"):
+            first = cp
+            continue
+        start = first if name.endswith(", Last>") else cp
+        first = None
+        for c in range(start, cp + 1):
+            cats[c] = category
+    return cats
+
+
+def read_derived(lines):
+    # start..end ; category # comment
+    cats = {}
+    for line in lines:
+        line = line.split("#", 1)[0].strip()
+        if not line:
+            continue
+        codes, category = (part.strip() for part in line.split(";"))
+        start, _, end = codes.partition("..")
+        for c in range(int(start, 16), int(end or start, 16) + 1):
+            cats[c] = category
+    return cats
+
+
+def read_categories(path):
+    with open(path, encoding="utf-8") as f:
+        lines = [line.rstrip("\n") for line in f]
+    data = [line for line in lines if line and not line.startswith("#")]
+    cats = read_unicode_data(data) if data and data[0].count(";") == 14 else read_derived(lines)
+    # unlisted code points are unassigned
+    return [CATEGORIES.index(cats.get(c, "Cn")) for c in range(CODE_POINTS)]
+
+
+def deduplicate(values, size):
+    # blocks of `size` values => index of each block in the list of the distinct ones
+    ids = {}
+    indices = [ids.setdefault(tuple(values[i:i + size]), len(ids)) for i in range(0, len(values), size)]
+    return indices, [value for block in ids for value in block]
+
+
+def numbers(values, per_line=32):
+    return "\n".join("\t" + ",".join(str(v) for v in values[i:i + per_line]) + "," for i in range(0, len(values), per_line))
+
+
+def tables(cats):
+    leaves, stage3 = deduplicate(cats, LEAF)
+    stage1, stage2 = deduplicate(leaves, MIDDLE)
+    assert max(stage1) < 256 and max(stage2) < 65536
+    text = "".join(chr(ord("a") + v) for v in stage3)
+    lines = [
+        "// generated by unicode-db/gen_categories.py from the general categories of Unicode %s (unicode-db/DerivedGeneralCategory.txt)" % VERSION,
+        "// in three stages: (code point >> 10) -> middle block, ((code point >> 5) & 31) -> leaf block, (code point & 31) -> 'a' + category",
+        "inline constexpr uint8_t category_stage1[%d] = {" % len(stage1),
+        numbers(stage1),
+        "};",
+        "",
+        "inline constexpr uint16_t category_stage2[%d] = {" % len(stage2),
+        numbers(stage2),
+        "};",
+        "",
+        "inline constexpr char category_stage3[%d] =" % (len(text) + 1),
+    ]
+    for i in range(0, len(text), 128):
+        lines.append('\t"' + text[i:i + 128] + '"' + (";" if i + 128 >= len(text) else ""))
+    return "\n".join(lines) + "\n"
+
+
+# from the comment above the tables to the end of the leaf blocks
+TABLES = re.compile(r"// generated [^\n]*\n//[^\n]*\ninline constexpr uint8_t category_stage1\[.*?\n\t\"[a-z~{|}]*\";\n", re.S)
+
+
+def main(argv):
+    check = "--check" in argv
+    args = [arg for arg in argv if arg != "--check"]
+    here = os.path.dirname(os.path.abspath(__file__))
+    source = args[0] if len(args) > 0 else os.path.join(here, "DerivedGeneralCategory.txt")
+    header = args[1] if len(args) > 1 else os.path.join(here, "..", "ctre.hpp")
+
+    generated = tables(read_categories(source))
+    with open(header, encoding="utf-8") as f:
+        content = f.read()
+    found = TABLES.search(content)
+    if not found:
+        sys.exit("%s: no category tables found" % header)
+    if found.group(0) == generated:
+        return 0
+    if check:
+        print("%s: category tables differ from %s" % (header, source))
+        return 1
+    with open(header, "w", encoding="utf-8") as f:
+        f.write(content[:found.start()] + generated + content[found.end():])
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))